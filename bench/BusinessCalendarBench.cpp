@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "BusinessCalendar.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Calendar over about 100 years with 10 holidays per year.
+   *
+   * @return BusinessCalendar
+   */
+  auto calendar() -> BusinessCalendar
+   {
+    std::vector<JD> holidays;
+    for (unsigned long day = 2451545; day < 2488070; day += 37)
+     {
+      holidays.emplace_back(day);
+     }
+    return(BusinessCalendar(JD(2451545), JD(2488070), holidays.data(), holidays.size()));
+   }
+
+
+  void BusinessCalendarAddBusinessDays(benchmark::State& state)
+   {
+    const BusinessCalendar cal = calendar();
+    unsigned long start = 2451545;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(cal.addBusinessDays(JD(start), static_cast<unsigned long>(state.range(0))));
+      start = (start == 2452545) ? 2451545 : (start + 1);
+     }
+   }
+  BENCHMARK(BusinessCalendarAddBusinessDays)->Arg(10)->Arg(10000);
+
+
+  void BusinessCalendarAddBusinessDaysLoop(benchmark::State& state)
+   {
+    const BusinessCalendar cal = calendar();
+    unsigned long start = 2451545;
+    for (auto _ : state)
+     {
+      JD day {start};
+      for (long businessDays = state.range(0); businessDays > 0; )
+       {
+        day = day + Days(1);
+        const Weekdays weekday = day.getWeekday();
+        if ((weekday != Weekdays::Saturday) && (weekday != Weekdays::Sunday) && cal.isBusinessDay(day))
+         {
+          --businessDays;
+         }
+       }
+      benchmark::DoNotOptimize(day);
+      start = (start == 2452545) ? 2451545 : (start + 1);
+     }
+   }
+  BENCHMARK(BusinessCalendarAddBusinessDaysLoop)->Arg(10)->Arg(10000);
+
+
+  void BusinessCalendarCountBusinessDays(benchmark::State& state)
+   {
+    const BusinessCalendar cal = calendar();
+    unsigned long start = 2451545;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(cal.countBusinessDays(JD(start), JD(start + 30000)));
+      start = (start == 2452545) ? 2451545 : (start + 1);
+     }
+   }
+  BENCHMARK(BusinessCalendarCountBusinessDays);
+
+ }
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+#include "DateBatch.h"
+#include "JulianDate.h"
+#include "GregorianDate.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Column of JD numbers for the batch benchmarks.
+   *
+   * @param[in] count Number of JD numbers
+   * @return JD numbers
+   */
+  auto jdColumn(const std::size_t count) -> std::vector<unsigned long>
+   {
+    std::vector<unsigned long> jds(count);
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      jds[i] = minJulianJD + ((i * 7919UL) % (maxJulianJD - minJulianJD));
+     }
+    return(jds);
+   }
+
+
+  void DateBatchDecodeSingle(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    for (auto _ : state)
+     {
+      for (std::size_t i = 0; i < jds.size(); ++i)
+       {
+        const JulianDate date {JD(jds[i])};
+        years[i] = date.getYear().getYear();
+        months[i] = date.getMonth().getMonth();
+        days[i] = date.getDay().getDay();
+       }
+      benchmark::DoNotOptimize(years.data());
+      benchmark::DoNotOptimize(months.data());
+      benchmark::DoNotOptimize(days.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchDecodeSingle)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchDecode(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(decodeJulianDates(jds.data(), jds.size(), years.data(), months.data(), days.data(), valid.data()));
+      benchmark::DoNotOptimize(years.data());
+      benchmark::DoNotOptimize(months.data());
+      benchmark::DoNotOptimize(days.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchDecode)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchEncodeSingle(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<JulianDate> dates;
+    for (const unsigned long jd : jds)
+     {
+      dates.emplace_back(JD(jd));
+     }
+    std::vector<unsigned long> result(jds.size());
+    for (auto _ : state)
+     {
+      for (std::size_t i = 0; i < dates.size(); ++i)
+       {
+        result[i] = julianToJD(dates[i].getYear().getYear(), dates[i].getMonth().getMonth(), dates[i].getDay().getDay());
+       }
+      benchmark::DoNotOptimize(result.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchEncodeSingle)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchEncode(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    decodeJulianDates(jds.data(), jds.size(), years.data(), months.data(), days.data(), nullptr);
+    std::vector<unsigned long> result(jds.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(encodeJulianDates(years.data(), months.data(), days.data(), years.size(), result.data(), valid.data()));
+      benchmark::DoNotOptimize(result.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchEncode)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchJulianToGregorianSingle(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<JulianDate> dates;
+    for (const unsigned long jd : jds)
+     {
+      dates.emplace_back(JD(jd > maxGregorianJD ? maxGregorianJD : jd));
+     }
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    for (auto _ : state)
+     {
+      for (std::size_t i = 0; i < dates.size(); ++i)
+       {
+        const GregorianDate date {dates[i]};
+        years[i] = date.getYear().getYear();
+        months[i] = date.getMonth().getMonth();
+        days[i] = date.getDay().getDay();
+       }
+      benchmark::DoNotOptimize(years.data());
+      benchmark::DoNotOptimize(months.data());
+      benchmark::DoNotOptimize(days.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchJulianToGregorianSingle)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchJulianToGregorian(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<long> julianYears(jds.size());
+    std::vector<unsigned short> julianMonths(jds.size());
+    std::vector<unsigned short> julianDays(jds.size());
+    decodeJulianDates(jds.data(), jds.size(), julianYears.data(), julianMonths.data(), julianDays.data(), nullptr);
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(julianToGregorianDates(julianYears.data(), julianMonths.data(), julianDays.data(), jds.size(), years.data(), months.data(), days.data(), valid.data()));
+      benchmark::DoNotOptimize(years.data());
+      benchmark::DoNotOptimize(months.data());
+      benchmark::DoNotOptimize(days.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchJulianToGregorian)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchGregorianToJulianSingle(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<GregorianDate> dates;
+    for (const unsigned long jd : jds)
+     {
+      dates.emplace_back(JD(jd > maxGregorianJD ? maxGregorianJD : jd));
+     }
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    for (auto _ : state)
+     {
+      for (std::size_t i = 0; i < dates.size(); ++i)
+       {
+        const JulianDate date {dates[i].getJD()};
+        years[i] = date.getYear().getYear();
+        months[i] = date.getMonth().getMonth();
+        days[i] = date.getDay().getDay();
+       }
+      benchmark::DoNotOptimize(years.data());
+      benchmark::DoNotOptimize(months.data());
+      benchmark::DoNotOptimize(days.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchGregorianToJulianSingle)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchGregorianToJulian(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<long> gregorianYears(jds.size());
+    std::vector<unsigned short> gregorianMonths(jds.size());
+    std::vector<unsigned short> gregorianDays(jds.size());
+    decodeGregorianDates(jds.data(), jds.size(), gregorianYears.data(), gregorianMonths.data(), gregorianDays.data(), nullptr);
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(gregorianToJulianDates(gregorianYears.data(), gregorianMonths.data(), gregorianDays.data(), jds.size(), years.data(), months.data(), days.data(), valid.data()));
+      benchmark::DoNotOptimize(years.data());
+      benchmark::DoNotOptimize(months.data());
+      benchmark::DoNotOptimize(days.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchGregorianToJulian)->Arg(1024)->Arg(1 << 20);
+
+
+
+  void DateBatchWeekdaysSingle(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<Weekdays> weekdays(jds.size());
+    for (auto _ : state)
+     {
+      for (std::size_t i = 0; i < jds.size(); ++i)
+       {
+        weekdays[i] = JulianDate(JD(jds[i])).getWeekday();
+       }
+      benchmark::DoNotOptimize(weekdays.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchWeekdaysSingle)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchWeekdays(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<unsigned short> weekdays(jds.size());
+    for (auto _ : state)
+     {
+      decodeWeekdays(jds.data(), jds.size(), weekdays.data());
+      benchmark::DoNotOptimize(weekdays.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchWeekdays)->Arg(1024)->Arg(1 << 20);
+
+
+  void DateBatchSelectWeekdays(benchmark::State& state)
+   {
+    const std::vector<unsigned long> jds = jdColumn(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> selected(validityMaskWords(jds.size()));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(selectWeekdays(jds.data(), jds.size(), (1U << 6U) | (1U << 7U), selected.data()));
+      benchmark::DoNotOptimize(selected.data());
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(DateBatchSelectWeekdays)->Arg(1024)->Arg(1 << 20);
+
+ }
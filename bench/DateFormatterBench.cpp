@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <vector>
+#include "DateFormatter.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Dates for the formatter benchmarks.
+   *
+   * @param[in] count Number of dates
+   * @return JulianDates
+   */
+  auto dates(const std::size_t count) -> std::vector<JulianDate>
+   {
+    std::vector<JulianDate> result;
+    result.reserve(count);
+    const unsigned long firstJD = julianToJD(1000, 1, 1);
+    const unsigned long lastJD = julianToJD(9999, 12, 31);
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      result.emplace_back(unchecked, JD(firstJD + ((i * 7919UL) % (lastJD - firstJD))));
+     }
+    return(result);
+   }
+
+
+  void DateFormatterOstream(benchmark::State& state)
+   {
+    const std::vector<JulianDate> column = dates(10000);
+    for (auto _ : state)
+     {
+      std::ostringstream out;
+      for (const JulianDate &date : column)
+       {
+        out << date << '\n';
+       }
+      benchmark::DoNotOptimize(out.str());
+     }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(column.size()));
+   }
+  BENCHMARK(DateFormatterOstream);
+
+
+  void DateFormatterToChars(benchmark::State& state)
+   {
+    const std::vector<JulianDate> column = dates(10000);
+    std::vector<char> buffer(column.size() * 12);
+    for (auto _ : state)
+     {
+      const std::to_chars_result result = toChars(buffer.data(), buffer.data() + buffer.size(), column.data(), column.size(), '\n');
+      benchmark::DoNotOptimize(result.ptr);
+      benchmark::ClobberMemory();
+     }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(column.size()));
+   }
+  BENCHMARK(DateFormatterToChars);
+
+
+  void DateFormatterToCharsWeek(benchmark::State& state)
+   {
+    const std::vector<JulianDate> column = dates(10000);
+    char buffer[16] = {};
+    for (auto _ : state)
+     {
+      for (const JulianDate &date : column)
+       {
+        const std::to_chars_result result = toCharsWeek(buffer, buffer + sizeof(buffer), date);
+        benchmark::DoNotOptimize(result.ptr);
+       }
+     }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(column.size()));
+   }
+  BENCHMARK(DateFormatterToCharsWeek);
+
+ }
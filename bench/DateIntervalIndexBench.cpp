@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "DateIntervalIndex.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Pseudo random intervals of up to 90 days within about 30 years.
+   *
+   * @param[in] count Number of intervals
+   * @return Intervals
+   */
+  auto random(const long count) -> std::vector<DateInterval>
+   {
+    unsigned long seed = 1;
+    std::vector<DateInterval> result;
+    for (long i = 0; i < count; ++i)
+     {
+      seed = (seed * 6364136223846793005UL) + 1442695040888963407UL;
+      const unsigned long first = 2450000 + ((seed >> 33U) % 11000);
+      result.emplace_back(JD(first), JD(first + ((seed >> 13U) % 90)));
+     }
+    return(result);
+   }
+
+
+  void DateIntervalIndexFindStabbing(benchmark::State& state)
+   {
+    const std::vector<DateInterval> intervals = random(state.range(0));
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    std::vector<std::uint32_t> result;
+    unsigned long day = 2450000;
+    for (auto _ : state)
+     {
+      result.clear();
+      index.findStabbing(JD(day), result);
+      benchmark::DoNotOptimize(result.data());
+      day = (day == 2461000) ? 2450000 : (day + 1);
+     }
+   }
+  BENCHMARK(DateIntervalIndexFindStabbing)->Arg(1 << 20);
+
+
+  void DateIntervalIndexFindStabbingScan(benchmark::State& state)
+   {
+    const std::vector<DateInterval> intervals = random(state.range(0));
+    std::vector<std::uint32_t> result;
+    unsigned long day = 2450000;
+    for (auto _ : state)
+     {
+      result.clear();
+      for (std::size_t i = 0; i < intervals.size(); ++i)
+       {
+        if (intervals[i].contains(JD(day)))
+         {
+          result.push_back(static_cast<std::uint32_t>(i));
+         }
+       }
+      benchmark::DoNotOptimize(result.data());
+      day = (day == 2461000) ? 2450000 : (day + 1);
+     }
+   }
+  BENCHMARK(DateIntervalIndexFindStabbingScan)->Arg(1 << 20);
+
+
+  void DateIntervalIndexFindStabbingBatch(benchmark::State& state)
+   {
+    const std::vector<DateInterval> intervals = random(state.range(0));
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    std::vector<JD> days;
+    for (unsigned long day = 2450000; day < 2451000; ++day)
+     {
+      days.emplace_back(day);
+     }
+    std::vector<std::uint32_t> result;
+    std::vector<std::size_t> offsets(days.size() + 1);
+    for (auto _ : state)
+     {
+      result.clear();
+      index.findStabbing(days.data(), days.size(), result, offsets.data());
+      benchmark::DoNotOptimize(result.data());
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(days.size()));
+   }
+  BENCHMARK(DateIntervalIndexFindStabbingBatch)->Arg(1 << 20);
+
+
+  void DateIntervalIndexFindStabbingBatchLoop(benchmark::State& state)
+   {
+    const std::vector<DateInterval> intervals = random(state.range(0));
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    std::vector<std::uint32_t> result;
+    for (auto _ : state)
+     {
+      result.clear();
+      for (unsigned long day = 2450000; day < 2451000; ++day)
+       {
+        index.findStabbing(JD(day), result);
+       }
+      benchmark::DoNotOptimize(result.data());
+     }
+    state.SetItemsProcessed(state.iterations() * 1000);
+   }
+  BENCHMARK(DateIntervalIndexFindStabbingBatchLoop)->Arg(1 << 20);
+
+ }
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "DateIntervalSet.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Pseudo random set of intervals.
+   *
+   * @param[in] seed Random seed
+   * @param[in] count Number of intervals
+   * @return DateIntervalSet
+   */
+  auto randomSet(unsigned long seed, const long count) -> DateIntervalSet
+   {
+    std::vector<DateInterval> intervals;
+    for (long i = 0; i < count; ++i)
+     {
+      seed = (seed * 6364136223846793005UL) + 1442695040888963407UL;
+      const unsigned long first = 2400000 + ((seed >> 33U) % (static_cast<unsigned long>(count) * 20));
+      intervals.emplace_back(JD(first), JD(first + ((seed >> 17U) % 15)));
+     }
+    return(DateIntervalSet(intervals.data(), intervals.size()));
+   }
+
+
+  void DateIntervalSetConstructor(benchmark::State& state)
+   {
+    const DateIntervalSet days = randomSet(1, state.range(0));
+    const std::vector<DateInterval> intervals(days.begin(), days.end());
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(DateIntervalSet(intervals.data(), intervals.size()));
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(intervals.size()));
+   }
+  BENCHMARK(DateIntervalSetConstructor)->Arg(1 << 20);
+
+
+  void DateIntervalSetUnite(benchmark::State& state)
+   {
+    const DateIntervalSet lhs = randomSet(1, state.range(0));
+    const DateIntervalSet rhs = randomSet(2, state.range(0));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(lhs | rhs);
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(lhs.size() + rhs.size()));
+   }
+  BENCHMARK(DateIntervalSetUnite)->Arg(1 << 20);
+
+
+  void DateIntervalSetIntersect(benchmark::State& state)
+   {
+    const DateIntervalSet lhs = randomSet(1, state.range(0));
+    const DateIntervalSet rhs = randomSet(2, state.range(0));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(lhs & rhs);
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(lhs.size() + rhs.size()));
+   }
+  BENCHMARK(DateIntervalSetIntersect)->Arg(1 << 20);
+
+
+  void DateIntervalSetSubtract(benchmark::State& state)
+   {
+    const DateIntervalSet lhs = randomSet(1, state.range(0));
+    const DateIntervalSet rhs = randomSet(2, state.range(0));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(lhs - rhs);
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(lhs.size() + rhs.size()));
+   }
+  BENCHMARK(DateIntervalSetSubtract)->Arg(1 << 20);
+
+ }
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <string>
+#include "DateParser.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Text with one date per line for the parser benchmarks.
+   *
+   * @param[in] count Number of dates
+   * @param[in] firstJD JD of the first date
+   * @param[in] lastJD JD of the last date
+   * @param[in] format printf format for year, month and day, or year and day within year
+   * @param[in] ordinal true: day within year, false: month and day
+   * @return Text
+   */
+  auto dateLines(const std::size_t count, const unsigned long firstJD, const unsigned long lastJD, const char *format, const bool ordinal) -> std::string
+   {
+    std::string text;
+    char line[16] = {};
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      const YearMonthDay ymd = jdToJulian(firstJD + ((i * 7919UL) % (lastJD - firstJD)));
+      const int size = ordinal ? std::snprintf(line, sizeof(line), format, ymd.year, julianDayWithinYear(ymd.year, ymd.month, ymd.day)) : std::snprintf(line, sizeof(line), format, ymd.year, ymd.month, ymd.day);
+      text.append(line, static_cast<std::size_t>(size));
+     }
+    return(text);
+   }
+
+
+  void parseLines(benchmark::State& state, const std::string &text)
+   {
+    for (auto _ : state)
+     {
+      const char *pos = text.data();
+      const char *const last = text.data() + text.size();
+      unsigned long sum = 0;
+      while (pos < last)
+       {
+        unsigned long jd = 0;
+        pos = parseJulianJD(pos, last, jd).ptr + 1;
+        sum += jd;
+       }
+      benchmark::DoNotOptimize(sum);
+     }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(text.size()));
+   }
+
+
+  void DateParserFixedWidth(benchmark::State& state)
+   {
+    parseLines(state, dateLines(100000, julianToJD(1000, 1, 1), julianToJD(9999, 12, 31), "%04ld-%02u-%02u\n", false));
+   }
+  BENCHMARK(DateParserFixedWidth);
+
+
+  void DateParserFiveDigitYears(benchmark::State& state)
+   {
+    parseLines(state, dateLines(100000, julianToJD(10000, 1, 1), maxJulianJD, "%05ld-%02u-%02u\n", false));
+   }
+  BENCHMARK(DateParserFiveDigitYears);
+
+
+  void DateParserOrdinal(benchmark::State& state)
+   {
+    parseLines(state, dateLines(100000, julianToJD(1000, 1, 1), julianToJD(9999, 12, 31), "%04ld-%03u\n", true));
+   }
+  BENCHMARK(DateParserOrdinal);
+
+ }
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include "Duration.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  void DurationConstructor(benchmark::State& state)
+   {
+    const unsigned long months = static_cast<unsigned long>(state.range(0));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(months);
+      benchmark::DoNotOptimize(Duration(Years(1), Months(months), Days(1)));
+     }
+   }
+  BENCHMARK(DurationConstructor)->Arg(1)->Arg(12)->Arg(12000);
+
+
+  void DurationGetter(benchmark::State& state)
+   {
+    Duration duration {Years(1), Months(2), Days(3)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration);
+      benchmark::DoNotOptimize(duration.getYears());
+      benchmark::DoNotOptimize(duration.getMonths());
+      benchmark::DoNotOptimize(duration.getDays());
+     }
+   }
+  BENCHMARK(DurationGetter);
+
+
+  void DurationCompare(benchmark::State& state)
+   {
+    Duration duration1 {Years(1), Months(2), Days(3)};
+    Duration duration2 {Years(1), Months(2), Days(4)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration1);
+      benchmark::DoNotOptimize(duration2);
+      benchmark::DoNotOptimize(duration1 == duration2);
+      benchmark::DoNotOptimize(duration1 < duration2);
+     }
+   }
+  BENCHMARK(DurationCompare);
+
+
+  void DurationPlusDuration(benchmark::State& state)
+   {
+    Duration duration1 {Years(1), Months(6), Days(3)};
+    Duration duration2 {Years(static_cast<unsigned long>(state.range(0))), Months(7), Days(4)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration1);
+      benchmark::DoNotOptimize(duration2);
+      benchmark::DoNotOptimize(duration1 + duration2);
+     }
+   }
+  BENCHMARK(DurationPlusDuration)->Arg(1)->Arg(100)->Arg(10000);
+
+
+  void DurationMinusDuration(benchmark::State& state)
+   {
+    Duration duration1 {Years(static_cast<unsigned long>(state.range(0))), Months(6), Days(3)};
+    Duration duration2 {Years(1), Months(2), Days(1)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration1);
+      benchmark::DoNotOptimize(duration2);
+      benchmark::DoNotOptimize(duration1 - duration2);
+     }
+   }
+  BENCHMARK(DurationMinusDuration)->Arg(1)->Arg(100)->Arg(10000);
+
+
+  void DurationMultiply(benchmark::State& state)
+   {
+    Duration duration {Years(1), Months(11), Days(0)};
+    const unsigned long factor = static_cast<unsigned long>(state.range(0));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration);
+      benchmark::DoNotOptimize(duration * factor);
+     }
+   }
+  BENCHMARK(DurationMultiply)->Arg(1)->Arg(12)->Arg(1000);
+
+
+  void DurationDivide(benchmark::State& state)
+   {
+    Duration duration {Years(100), Months(11), Days(30)};
+    const unsigned long divisor = static_cast<unsigned long>(state.range(0));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration);
+      benchmark::DoNotOptimize(duration / divisor);
+      benchmark::DoNotOptimize(duration % divisor);
+     }
+   }
+  BENCHMARK(DurationDivide)->Arg(1)->Arg(7);
+
+
+  void DurationPlusDays(benchmark::State& state)
+   {
+    Duration duration {Years(1), Months(2), Days(3)};
+    const Days days {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration);
+      benchmark::DoNotOptimize(duration + days);
+      benchmark::DoNotOptimize(duration - days);
+     }
+   }
+  BENCHMARK(DurationPlusDays)->Arg(1)->Arg(27);
+
+
+  void DurationPlusMonths(benchmark::State& state)
+   {
+    Duration duration {Years(10000), Months(2), Days(3)};
+    const Months months {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration);
+      benchmark::DoNotOptimize(duration + months);
+      benchmark::DoNotOptimize(duration - months);
+     }
+   }
+  BENCHMARK(DurationPlusMonths)->Arg(1)->Arg(12)->Arg(12000);
+
+
+  void DurationPlusYears(benchmark::State& state)
+   {
+    Duration duration {Years(10000), Months(2), Days(3)};
+    const Years years {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(duration);
+      benchmark::DoNotOptimize(duration + years);
+      benchmark::DoNotOptimize(duration - years);
+     }
+   }
+  BENCHMARK(DurationPlusYears)->Arg(1)->Arg(100)->Arg(10000);
+
+
+  void DurationStream(benchmark::State& state)
+   {
+    const Duration duration {Years(1), Months(2), Days(3)};
+    std::ostringstream outs;
+    for (auto _ : state)
+     {
+      outs.str("");
+      outs << duration;
+      benchmark::DoNotOptimize(outs);
+     }
+   }
+  BENCHMARK(DurationStream);
+
+ }
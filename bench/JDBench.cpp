@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include "JD.h"
+#include "Days.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  void JDConstructor(benchmark::State& state)
+   {
+    unsigned long value = 2299160;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(value);
+      benchmark::DoNotOptimize(JD(value));
+     }
+   }
+  BENCHMARK(JDConstructor);
+
+
+  void JDGetJD(benchmark::State& state)
+   {
+    JD jd {2299160};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(jd);
+      benchmark::DoNotOptimize(jd.getJD());
+     }
+   }
+  BENCHMARK(JDGetJD);
+
+
+  void JDCompare(benchmark::State& state)
+   {
+    JD jd1 {2299160};
+    JD jd2 {2299161};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(jd1);
+      benchmark::DoNotOptimize(jd2);
+      benchmark::DoNotOptimize(jd1 == jd2);
+      benchmark::DoNotOptimize(jd1 < jd2);
+     }
+   }
+  BENCHMARK(JDCompare);
+
+
+  void JDPlusDays(benchmark::State& state)
+   {
+    JD jd {2299160};
+    const Days days {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(jd);
+      benchmark::DoNotOptimize(jd + days);
+     }
+   }
+  BENCHMARK(JDPlusDays)->Arg(1)->Arg(365)->Arg(100000);
+
+
+  void JDMinusDays(benchmark::State& state)
+   {
+    JD jd {2299160};
+    const Days days {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(jd);
+      benchmark::DoNotOptimize(jd - days);
+     }
+   }
+  BENCHMARK(JDMinusDays)->Arg(1)->Arg(365)->Arg(100000);
+
+
+  void JDMinusJD(benchmark::State& state)
+   {
+    JD jd1 {2299160};
+    JD jd2 {2299160 + static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(jd1);
+      benchmark::DoNotOptimize(jd2);
+      benchmark::DoNotOptimize(jd2 - jd1);
+     }
+   }
+  BENCHMARK(JDMinusJD)->Arg(1)->Arg(365)->Arg(100000);
+
+
+  void JDStream(benchmark::State& state)
+   {
+    const JD jd {2299160};
+    std::ostringstream outs;
+    for (auto _ : state)
+     {
+      outs.str("");
+      outs << jd;
+      benchmark::DoNotOptimize(outs);
+     }
+   }
+  BENCHMARK(JDStream);
+
+ }
@@ -0,0 +1,397 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "JulianDate.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Distances in days, months or years for the arithmetic benchmarks.
+   */
+  void distances(benchmark::internal::Benchmark *bench)
+   {
+    bench->Arg(1)->Arg(365)->Arg(100000);
+   }
+
+
+  void JulianDateConstructor1(benchmark::State& state)
+   {
+    long year = 1000;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(year);
+      benchmark::DoNotOptimize(JulianDate(JulianYear(year), JulianMonth(12), JulianDay(31)));
+     }
+   }
+  BENCHMARK(JulianDateConstructor1);
+
+
+  void JulianDateConstructor2(benchmark::State& state)
+   {
+    unsigned long jd = 2299160;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(jd);
+      benchmark::DoNotOptimize(JulianDate(JD(jd)));
+     }
+   }
+  BENCHMARK(JulianDateConstructor2);
+
+
+  void JulianDateConstructorInvalid(benchmark::State& state)
+   {
+    unsigned short day = 29;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(day);
+      try
+       {
+        benchmark::DoNotOptimize(JulianDate(JulianYear(1001), JulianMonth(2), JulianDay(day)));
+       }
+      catch (const std::out_of_range& e)
+       {
+        benchmark::DoNotOptimize(e);
+       }
+     }
+   }
+  BENCHMARK(JulianDateConstructorInvalid);
+
+
+  void JulianDateTryMake(benchmark::State& state)
+   {
+    unsigned short day = static_cast<unsigned short>(state.range(0));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(day);
+      benchmark::DoNotOptimize(JulianDate::tryMake(1001, 2, day));
+     }
+   }
+  BENCHMARK(JulianDateTryMake)->Arg(28)->Arg(29);
+
+
+  void JulianDateGetter(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date.getYear());
+      benchmark::DoNotOptimize(date.getMonth());
+      benchmark::DoNotOptimize(date.getDay());
+     }
+   }
+  BENCHMARK(JulianDateGetter);
+
+
+  void JulianDateGetWeekday(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date.getWeekday());
+     }
+   }
+  BENCHMARK(JulianDateGetWeekday);
+
+
+  void JulianDateGetDayWithinYear(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date.getDayWithinYear());
+     }
+   }
+  BENCHMARK(JulianDateGetDayWithinYear);
+
+
+  void JulianDateGetWeek(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(1), JulianDay(1)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date.getWeek());
+     }
+   }
+  BENCHMARK(JulianDateGetWeek);
+
+
+  void JulianDateGetJD(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date.getJD());
+     }
+   }
+  BENCHMARK(JulianDateGetJD);
+
+
+  void JulianDateCompare(benchmark::State& state)
+   {
+    JulianDate date1 {JulianYear(1000), JulianMonth(12), JulianDay(30)};
+    JulianDate date2 {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date1);
+      benchmark::DoNotOptimize(date2);
+      benchmark::DoNotOptimize(date1 == date2);
+      benchmark::DoNotOptimize(date1 < date2);
+     }
+   }
+  BENCHMARK(JulianDateCompare);
+
+
+  void JulianDatePlusYears(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    const Years years {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date + years);
+     }
+   }
+  BENCHMARK(JulianDatePlusYears)->Arg(1)->Arg(100)->Arg(10000);
+
+
+  void JulianDateMinusYears(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(20000), JulianMonth(12), JulianDay(31)};
+    const Years years {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date - years);
+     }
+   }
+  BENCHMARK(JulianDateMinusYears)->Arg(1)->Arg(100)->Arg(10000);
+
+
+  void JulianDatePlusMonths(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(28)};
+    const Months months {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date + months);
+     }
+   }
+  BENCHMARK(JulianDatePlusMonths)->Arg(1)->Arg(12)->Arg(12000);
+
+
+  void JulianDateMinusMonths(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(20000), JulianMonth(12), JulianDay(28)};
+    const Months months {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date - months);
+     }
+   }
+  BENCHMARK(JulianDateMinusMonths)->Arg(1)->Arg(12)->Arg(12000);
+
+
+  void JulianDatePlusDays(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    const Days days {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date + days);
+     }
+   }
+  BENCHMARK(JulianDatePlusDays)->Apply(distances);
+
+
+  void JulianDateMinusDays(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    const Days days {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date - days);
+     }
+   }
+  BENCHMARK(JulianDateMinusDays)->Apply(distances);
+
+
+  void JulianDatePlusWeeks(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    const Weeks weeks {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date + weeks);
+     }
+   }
+  BENCHMARK(JulianDatePlusWeeks)->Arg(1)->Arg(52)->Arg(10000);
+
+
+  void JulianDateMinusWeeks(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    const Weeks weeks {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date - weeks);
+     }
+   }
+  BENCHMARK(JulianDateMinusWeeks)->Arg(1)->Arg(52)->Arg(10000);
+
+
+  void JulianDatePlusDuration(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(1), JulianDay(1)};
+    const Duration duration {Years(static_cast<unsigned long>(state.range(0))), Months(1), Days(1)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date + duration);
+     }
+   }
+  BENCHMARK(JulianDatePlusDuration)->Arg(1)->Arg(100)->Arg(10000);
+
+
+  void JulianDateMinusDuration(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(20000), JulianMonth(3), JulianDay(3)};
+    const Duration duration {Years(static_cast<unsigned long>(state.range(0))), Months(1), Days(1)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date - duration);
+     }
+   }
+  BENCHMARK(JulianDateMinusDuration)->Arg(1)->Arg(100)->Arg(10000);
+
+
+  void JulianDatePlusWeekdays(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date + Weekdays::Sunday);
+     }
+   }
+  BENCHMARK(JulianDatePlusWeekdays);
+
+
+  void JulianDateMinusWeekdays(benchmark::State& state)
+   {
+    JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date);
+      benchmark::DoNotOptimize(date - Weekdays::Monday);
+     }
+   }
+  BENCHMARK(JulianDateMinusWeekdays);
+
+
+  void JulianDateDayDiff(benchmark::State& state)
+   {
+    JulianDate date1 {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    JulianDate date2 = date1 + Days(static_cast<unsigned long>(state.range(0)));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date1);
+      benchmark::DoNotOptimize(date2);
+      benchmark::DoNotOptimize(dayDiff(date1, date2));
+     }
+   }
+  BENCHMARK(JulianDateDayDiff)->Apply(distances);
+
+
+  void JulianDateMinusJulianDate(benchmark::State& state)
+   {
+    JulianDate date1 {JulianYear(1000), JulianMonth(12), JulianDay(1)};
+    JulianDate date2 = date1 + Days(static_cast<unsigned long>(state.range(0)));
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(date1);
+      benchmark::DoNotOptimize(date2);
+      benchmark::DoNotOptimize(date2 - date1);
+     }
+   }
+  BENCHMARK(JulianDateMinusJulianDate)->Apply(distances);
+
+
+  void JulianDateGetEaster(benchmark::State& state)
+   {
+    long year = 1000;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(year);
+      benchmark::DoNotOptimize(getEaster(JulianYear(year)));
+     }
+   }
+  BENCHMARK(JulianDateGetEaster);
+
+
+  void JulianDateGetEasterBatch(benchmark::State& state)
+   {
+    std::vector<JulianYear> years;
+    for (long year = 1000; year < 1000 + state.range(0); ++year)
+     {
+      years.emplace_back(year);
+     }
+    std::vector<JulianDate> easters(years.size(), JulianDate(JD(minJulianJD)));
+    for (auto _ : state)
+     {
+      getEaster(years.data(), years.size(), easters.data());
+      benchmark::DoNotOptimize(easters.data());
+      benchmark::ClobberMemory();
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(JulianDateGetEasterBatch)->Arg(532)->Arg(8192);
+
+
+  void JulianDateFactory(benchmark::State& state)
+   {
+    long year = 1000;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(year);
+      benchmark::DoNotOptimize(factory(JulianYear(year), JulianWeek(30), Weekdays::Wednesday));
+     }
+   }
+  BENCHMARK(JulianDateFactory);
+
+
+  void JulianDateStream(benchmark::State& state)
+   {
+    const JulianDate date {JulianYear(1000), JulianMonth(12), JulianDay(31)};
+    std::ostringstream outs;
+    for (auto _ : state)
+     {
+      outs.str("");
+      outs << date;
+      benchmark::DoNotOptimize(outs);
+     }
+   }
+  BENCHMARK(JulianDateStream);
+
+ }
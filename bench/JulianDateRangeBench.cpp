@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "JulianDateRange.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  void JulianDateRangePlusDays(benchmark::State& state)
+   {
+    const JulianDate first {JulianYear(2000), JulianMonth(1), JulianDay(1)};
+    const JulianDate last {JulianYear(2009), JulianMonth(12), JulianDay(31)};
+    for (auto _ : state)
+     {
+      for (JulianDate date = first; date <= last; date = date + Days(1))
+       {
+        benchmark::DoNotOptimize(date);
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(JulianDateRange(first, last).size()));
+   }
+  BENCHMARK(JulianDateRangePlusDays);
+
+
+  void JulianDateRangeDays(benchmark::State& state)
+   {
+    const JulianDate first {JulianYear(2000), JulianMonth(1), JulianDay(1)};
+    const JulianDate last {JulianYear(2009), JulianMonth(12), JulianDay(31)};
+    const JulianDateRange range {first, last};
+    for (auto _ : state)
+     {
+      for (const JulianDate date : range)
+       {
+        benchmark::DoNotOptimize(date);
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(range.size()));
+   }
+  BENCHMARK(JulianDateRangeDays);
+
+
+  void JulianDateRangeDaysWeekday(benchmark::State& state)
+   {
+    const JulianDate first {JulianYear(2000), JulianMonth(1), JulianDay(1)};
+    const JulianDate last {JulianYear(2009), JulianMonth(12), JulianDay(31)};
+    const JulianDateRange range {first, last};
+    for (auto _ : state)
+     {
+      for (auto iter = range.begin(); iter != range.end(); ++iter)
+       {
+        benchmark::DoNotOptimize(*iter);
+        benchmark::DoNotOptimize(iter.getWeekday());
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(range.size()));
+   }
+  BENCHMARK(JulianDateRangeDaysWeekday);
+
+
+  void JulianDateRangeMonths(benchmark::State& state)
+   {
+    const JulianDate first {JulianYear(2000), JulianMonth(1), JulianDay(31)};
+    const JulianDate last {JulianYear(2999), JulianMonth(12), JulianDay(31)};
+    const JulianDateRange range {first, last, Months(1)};
+    for (auto _ : state)
+     {
+      for (const JulianDate date : range)
+       {
+        benchmark::DoNotOptimize(date);
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(range.size()));
+   }
+  BENCHMARK(JulianDateRangeMonths);
+
+ }
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include "JulianHolidays.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Some holiday rules.
+   */
+  const std::array<HolidayRule, 8> rules {HolidayRule::fixed(JulianMonth(1), JulianDay(1)), HolidayRule::fixed(JulianMonth(5), JulianDay(1)), HolidayRule::fixed(JulianMonth(12), JulianDay(25)), HolidayRule::fixed(JulianMonth(12), JulianDay(26)), HolidayRule::nthWeekday(JulianMonth(5), Weekdays::Monday, -1), HolidayRule::easter(-2), HolidayRule::easter(1), HolidayRule::easter(50)};
+
+
+  void JulianHolidaysIsHoliday(benchmark::State& state)
+   {
+    const JulianHolidays holidays {rules.data(), rules.size()};
+    unsigned long jd = 2451545;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(holidays.isHoliday(JD(jd)));
+      jd = (jd == 2488070) ? 2451545 : (jd + 1);
+     }
+   }
+  BENCHMARK(JulianHolidaysIsHoliday);
+
+
+  void JulianHolidaysIsHolidayRules(benchmark::State& state)
+   {
+    unsigned long jd = 2451545;
+    for (auto _ : state)
+     {
+      const JulianDate date {unchecked, JD(jd)};
+      const long year = date.getYear().getYear();
+      const unsigned short dayWithinYear = static_cast<unsigned short>(date.getDayWithinYear().getDays());
+      bool holiday = false;
+      for (const HolidayRule &rule : rules)
+       {
+        holiday = holiday || (rule.getDayWithinYear(year) == dayWithinYear);
+       }
+      benchmark::DoNotOptimize(holiday);
+      jd = (jd == 2488070) ? 2451545 : (jd + 1);
+     }
+   }
+  BENCHMARK(JulianHolidaysIsHolidayRules);
+
+ }
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "JulianRecurrence.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  void JulianRecurrenceDaily(benchmark::State& state)
+   {
+    const JulianRecurrence recurrence {JulianDate(JulianYear(2000), JulianMonth(1), JulianDay(1)), RecurrenceRule(Frequency::Daily).withCount(static_cast<unsigned long>(state.range(0)))};
+    for (auto _ : state)
+     {
+      for (auto iter = recurrence.begin(); iter != recurrence.end(); ++iter)
+       {
+        benchmark::DoNotOptimize(iter.getJD());
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(JulianRecurrenceDaily)->Arg(1 << 20);
+
+
+  void JulianRecurrenceLastWeekdayOfMonth(benchmark::State& state)
+   {
+    const RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withByDay(Weekdays::Monday).withByDay(Weekdays::Tuesday).withByDay(Weekdays::Wednesday).withByDay(Weekdays::Thursday).withByDay(Weekdays::Friday).withBySetPos(-1).withCount(static_cast<unsigned long>(state.range(0)));
+    const JulianRecurrence recurrence {JulianDate(JulianYear(2000), JulianMonth(1), JulianDay(1)), rule};
+    for (auto _ : state)
+     {
+      for (const JulianDate date : recurrence)
+       {
+        benchmark::DoNotOptimize(date);
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(JulianRecurrenceLastWeekdayOfMonth)->Arg(12000);
+
+
+  void JulianRecurrenceLastWeekdayOfMonthLoop(benchmark::State& state)
+   {
+    for (auto _ : state)
+     {
+      JulianDate month {JulianYear(2000), JulianMonth(1), JulianDay(1)};
+      for (long i = 0; i < state.range(0); ++i)
+       {
+        JulianDate date = month + Months(1) - Days(1);
+        while ((date.getWeekday() == Weekdays::Saturday) || (date.getWeekday() == Weekdays::Sunday))
+         {
+          date = date - Days(1);
+         }
+        benchmark::DoNotOptimize(date);
+        month = month + Months(1);
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(JulianRecurrenceLastWeekdayOfMonthLoop)->Arg(12000);
+
+
+  void JulianRecurrenceEveryOtherTuesday(benchmark::State& state)
+   {
+    const JulianRecurrence recurrence {JulianDate(JulianYear(2000), JulianMonth(1), JulianDay(1)), RecurrenceRule(Frequency::Weekly, 2).withByDay(Weekdays::Tuesday).withCount(static_cast<unsigned long>(state.range(0)))};
+    for (auto _ : state)
+     {
+      for (const JulianDate date : recurrence)
+       {
+        benchmark::DoNotOptimize(date);
+       }
+     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+   }
+  BENCHMARK(JulianRecurrenceEveryOtherTuesday)->Arg(100000);
+
+ }
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include "JulianWeek.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  void JulianWeekConstructor1(benchmark::State& state)
+   {
+    unsigned short value = 30;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(value);
+      benchmark::DoNotOptimize(JulianWeek(value));
+     }
+   }
+  BENCHMARK(JulianWeekConstructor1);
+
+
+  void JulianWeekConstructor2(benchmark::State& state)
+   {
+    unsigned short value = 30;
+    long year = 1000;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(value);
+      benchmark::DoNotOptimize(year);
+      benchmark::DoNotOptimize(JulianWeek(value, JulianYear(year)));
+     }
+   }
+  BENCHMARK(JulianWeekConstructor2);
+
+
+  void JulianWeekGetter(benchmark::State& state)
+   {
+    JulianWeek week {30};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(week);
+      benchmark::DoNotOptimize(week.getWeek());
+      benchmark::DoNotOptimize(week.getMaxWeeks());
+     }
+   }
+  BENCHMARK(JulianWeekGetter);
+
+
+  void JulianWeekCompare(benchmark::State& state)
+   {
+    JulianWeek week1 {30};
+    JulianWeek week2 {31};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(week1);
+      benchmark::DoNotOptimize(week2);
+      benchmark::DoNotOptimize(week1 == week2);
+      benchmark::DoNotOptimize(week1 < week2);
+     }
+   }
+  BENCHMARK(JulianWeekCompare);
+
+
+  void JulianWeekPlusWeeks(benchmark::State& state)
+   {
+    JulianWeek week {1};
+    const Weeks weeks {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(week);
+      benchmark::DoNotOptimize(week + weeks);
+     }
+   }
+  BENCHMARK(JulianWeekPlusWeeks)->Arg(1)->Arg(51);
+
+
+  void JulianWeekMinusWeeks(benchmark::State& state)
+   {
+    JulianWeek week {52};
+    const Weeks weeks {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(week);
+      benchmark::DoNotOptimize(week - weeks);
+     }
+   }
+  BENCHMARK(JulianWeekMinusWeeks)->Arg(1)->Arg(51);
+
+
+  void JulianWeekMinusJulianWeek(benchmark::State& state)
+   {
+    JulianWeek week1 {1};
+    JulianWeek week2 {52};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(week1);
+      benchmark::DoNotOptimize(week2);
+      benchmark::DoNotOptimize(week2 - week1);
+     }
+   }
+  BENCHMARK(JulianWeekMinusJulianWeek);
+
+
+  void JulianWeekStream(benchmark::State& state)
+   {
+    const JulianWeek week {30};
+    std::ostringstream outs;
+    for (auto _ : state)
+     {
+      outs.str("");
+      outs << week;
+      benchmark::DoNotOptimize(outs);
+     }
+   }
+  BENCHMARK(JulianWeekStream);
+
+ }
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include "MJD.h"
+#include "JD.h"
+#include "Days.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  void MJDConstructor(benchmark::State& state)
+   {
+    unsigned long value = 158000;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(value);
+      benchmark::DoNotOptimize(MJD(value));
+     }
+   }
+  BENCHMARK(MJDConstructor);
+
+
+  void MJDConstructorJD(benchmark::State& state)
+   {
+    unsigned long value = 24158000;
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(value);
+      benchmark::DoNotOptimize(MJD(JD(value)));
+     }
+   }
+  BENCHMARK(MJDConstructorJD);
+
+
+  void MJDGetMJD(benchmark::State& state)
+   {
+    MJD mjd {158000};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(mjd);
+      benchmark::DoNotOptimize(mjd.getMJD());
+     }
+   }
+  BENCHMARK(MJDGetMJD);
+
+
+  void MJDGetJD(benchmark::State& state)
+   {
+    MJD mjd {158000};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(mjd);
+      benchmark::DoNotOptimize(mjd.getJD());
+     }
+   }
+  BENCHMARK(MJDGetJD);
+
+
+  void MJDCompare(benchmark::State& state)
+   {
+    MJD mjd1 {158000};
+    MJD mjd2 {2299161};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(mjd1);
+      benchmark::DoNotOptimize(mjd2);
+      benchmark::DoNotOptimize(mjd1 == mjd2);
+      benchmark::DoNotOptimize(mjd1 < mjd2);
+     }
+   }
+  BENCHMARK(MJDCompare);
+
+
+  void MJDPlusDays(benchmark::State& state)
+   {
+    MJD mjd {158000};
+    const Days days {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(mjd);
+      benchmark::DoNotOptimize(mjd + days);
+     }
+   }
+  BENCHMARK(MJDPlusDays)->Arg(1)->Arg(365)->Arg(100000);
+
+
+  void MJDMinusDays(benchmark::State& state)
+   {
+    MJD mjd {158000};
+    const Days days {static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(mjd);
+      benchmark::DoNotOptimize(mjd - days);
+     }
+   }
+  BENCHMARK(MJDMinusDays)->Arg(1)->Arg(365)->Arg(100000);
+
+
+  void MJDMinusMJD(benchmark::State& state)
+   {
+    MJD mjd1 {158000};
+    MJD mjd2 {158000 + static_cast<unsigned long>(state.range(0))};
+    for (auto _ : state)
+     {
+      benchmark::DoNotOptimize(mjd1);
+      benchmark::DoNotOptimize(mjd2);
+      benchmark::DoNotOptimize(mjd2 - mjd1);
+     }
+   }
+  BENCHMARK(MJDMinusMJD)->Arg(1)->Arg(365)->Arg(100000);
+
+
+  void MJDStream(benchmark::State& state)
+   {
+    const MJD mjd {158000};
+    std::ostringstream outs;
+    for (auto _ : state)
+     {
+      outs.str("");
+      outs << mjd;
+      benchmark::DoNotOptimize(outs);
+     }
+   }
+  BENCHMARK(MJDStream);
+
+ }
@@ -0,0 +1,129 @@
+/** @file
+ * Bit operations on 64 bit words for the bitmask based classes.
+ * C++17 has no <bit> header, so that GCC and Clang use their bit scan builtins and other compilers a portable constexpr fallback.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_BITS_H_
+#define DATELIB_BITS_H_
+
+
+#include <cstdint>
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Number of set bits within each byte of a word.
+   *
+   * @param[in] word Word
+   * @return Word with the number of set bits (0-8) of byte n within byte n
+   */
+  [[nodiscard]] constexpr auto popcountBytes(std::uint64_t word) noexcept -> std::uint64_t
+   {
+    word -= (word >> 1U) & 0x5555555555555555ULL;
+    word = (word & 0x3333333333333333ULL) + ((word >> 2U) & 0x3333333333333333ULL);
+    return((word + (word >> 4U)) & 0x0F0F0F0F0F0F0F0FULL);
+   }
+
+
+  /**
+   * Number of set bits.
+   *
+   * @param[in] word Word
+   * @return Number of set bits (0-64)
+   */
+  [[nodiscard]] constexpr auto popcount(const std::uint64_t word) noexcept -> unsigned short
+   {
+    return(static_cast<unsigned short>((popcountBytes(word) * 0x0101010101010101ULL) >> 56U));
+   }
+
+
+  /**
+   * Pack a word of byte flags into bits.
+   *
+   * The multiplication moves every byte into the top byte at a different bit, without carries between them.
+   *
+   * @param[in] word Word with bytes that are 0 or 1
+   * @return Bit n is byte n of word
+   */
+  [[nodiscard]] constexpr auto packByteFlags(const std::uint64_t word) noexcept -> std::uint64_t
+   {
+    return((word * 0x0102040810204080ULL) >> 56U);
+   }
+
+
+  /**
+   * Index of the lowest set bit.
+   *
+   * @param[in] word Word that is not 0
+   * @return Bit index (0-63)
+   */
+  [[nodiscard]] constexpr auto lowestBit(const std::uint64_t word) noexcept -> unsigned short
+   {
+#if defined(__GNUC__)
+    return(static_cast<unsigned short>(__builtin_ctzll(word)));
+#else
+    return(popcount((word & (~word + 1U)) - 1U));
+#endif
+   }
+
+
+  /**
+   * Index of the highest set bit.
+   *
+   * @param[in] word Word that is not 0
+   * @return Bit index (0-63)
+   */
+  [[nodiscard]] constexpr auto highestBit(std::uint64_t word) noexcept -> unsigned short
+   {
+#if defined(__GNUC__)
+    return(static_cast<unsigned short>(63 - __builtin_clzll(word)));
+#else
+    word |= word >> 1U;
+    word |= word >> 2U;
+    word |= word >> 4U;
+    word |= word >> 8U;
+    word |= word >> 16U;
+    word |= word >> 32U;
+    return(static_cast<unsigned short>(popcount(word) - 1U));
+#endif
+   }
+
+
+  /**
+   * Index of the n-th lowest set bit.
+   *
+   * The byte is found from the running byte counts, so that only the bits of one byte are cleared one by one.
+   *
+   * @param[in] word Word
+   * @param[in] rank Number of set bits below the wanted one (0-popcount(word)-1)
+   * @return Bit index (0-63)
+   */
+  [[nodiscard]] constexpr auto selectBit(const std::uint64_t word, unsigned short rank) noexcept -> unsigned short
+   {
+    // Byte n holds the number of set bits within the bytes 0-n
+    const std::uint64_t counts = popcountBytes(word) * 0x0101010101010101ULL;
+    unsigned short shift = 0;
+    while (((counts >> shift) & 0xFFU) <= rank)
+     {
+      shift += 8;
+     }
+    if (shift != 0)
+     {
+      rank -= static_cast<unsigned short>((counts >> (shift - 8U)) & 0xFFU);
+     }
+    std::uint64_t bits = (word >> shift) & 0xFFU;
+    for (; rank > 0; --rank)
+     {
+      bits &= bits - 1U;
+     }
+    return(static_cast<unsigned short>(shift + lowestBit(bits)));
+   }
+
+ } // namespace
+
+#endif // DATELIB_BITS_H_
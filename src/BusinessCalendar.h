@@ -0,0 +1,271 @@
+/** @file
+ * Business day calendar with weekends and holidays.
+ * Keeps one bit per day and the number of business days before every 64 day block,
+ * so that counting is constant time and adding business days is a binary search over the blocks.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_BUSINESSCALENDAR_H_
+#define DATELIB_BUSINESSCALENDAR_H_
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+#include "Bits.h"
+#include "JD.h"
+#include "Weekdays.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Calendar of business days from a first to a last JD (inclusive).
+   *
+   * A day is a business day when its weekday is not part of the weekend and it is not a holiday.
+   */
+  class BusinessCalendar final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] first First JD of the calendar
+       * @param[in] last Last JD of the calendar (inclusive)
+       * @param[in] holidays Holidays, entries outside of first to last are ignored
+       * @param[in] count Number of holidays
+       * @param[in] weekend Weekend days, saturday and sunday by default
+       * @throws std::out_of_range When first > last or weekend contains a value that is not a weekday
+       */
+      BusinessCalendar(const JD first, const JD last, const JD *holidays, const std::size_t count, const std::initializer_list<Weekdays> weekend = {Weekdays::Saturday, Weekdays::Sunday})
+       : first(first.getJD()), last(last.getJD())
+       {
+        if (this->first > this->last)
+         {
+          throw std::out_of_range("first > last");
+         }
+        unsigned long weekendDays = 0;
+        for (const Weekdays weekday : weekend)
+         {
+          if ((static_cast<unsigned short>(weekday) < 1) || (static_cast<unsigned short>(weekday) > 7))
+           {
+            throw std::out_of_range("weekend is not a set of weekdays");
+           }
+          weekendDays |= 1UL << static_cast<unsigned short>(weekday);
+         }
+        const unsigned long days = this->last - this->first + 1;
+        const std::size_t words = static_cast<std::size_t>((days + 63) / 64);
+        this->bits.resize(words);
+        // Business weekdays as bits 0-6 for monday to sunday, rotated to the weekday of the first day of each block
+        const unsigned long pattern = (~weekendDays & 0xFEUL) >> 1U;
+        unsigned long offset = jdToWeekday(this->first) - 1UL;
+        for (std::size_t word = 0; word < words; ++word)
+         {
+          const unsigned long rotated = ((pattern >> offset) | (pattern << (7U - offset))) & 0x7FUL;
+          this->bits[word] = rotated * 0x8102040810204081ULL;
+          offset = (offset + 64UL) % 7UL;
+         }
+        if ((days % 64) != 0)
+         {
+          this->bits[words - 1] &= (std::uint64_t{1} << (days % 64)) - 1U;
+         }
+        for (std::size_t i = 0; i < count; ++i)
+         {
+          const unsigned long jd = holidays[i].getJD();
+          if ((jd >= this->first) && (jd <= this->last))
+           {
+            this->bits[(jd - this->first) / 64] &= ~(std::uint64_t{1} << ((jd - this->first) % 64));
+           }
+         }
+        this->ranks.resize(words + 1);
+        unsigned long rank = 0;
+        for (std::size_t word = 0; word < words; ++word)
+         {
+          this->ranks[word] = rank;
+          rank += popcount(this->bits[word]);
+         }
+        this->ranks[words] = rank;
+       }
+
+
+      /**
+       * Get first JD.
+       *
+       * @return First JD of the calendar
+       */
+      [[nodiscard]] auto getFirst() const noexcept -> JD
+       {
+        return(JD(this->first));
+       }
+
+
+      /**
+       * Get last JD.
+       *
+       * @return Last JD of the calendar (inclusive)
+       */
+      [[nodiscard]] auto getLast() const noexcept -> JD
+       {
+        return(JD(this->last));
+       }
+
+
+      /**
+       * Is a day a business day.
+       *
+       * @param[in] day Day
+       * @return true when day is a business day, false otherwise
+       * @throws std::out_of_range When day is outside of the calendar
+       */
+      [[nodiscard]] auto isBusinessDay(const JD day) const -> bool
+       {
+        const unsigned long index = this->index(day);
+        return(((this->bits[index / 64] >> (index % 64)) & 1U) != 0);
+       }
+
+
+      /**
+       * Count the business days from one day up to, but not including, another day.
+       *
+       * The order of the days does not matter, like the difference of two JD objects.
+       * The day after the last day of the calendar is allowed, so that all days of the calendar could be counted.
+       *
+       * @param[in] from First day
+       * @param[in] to Day after the last day
+       * @return Number of business days
+       * @throws std::out_of_range When one of the days is outside of the calendar and not the day after its last day
+       */
+      [[nodiscard]] auto countBusinessDays(const JD from, const JD to) const -> unsigned long
+       {
+        const unsigned long fromRank = rankOfBoundary(from);
+        const unsigned long toRank = rankOfBoundary(to);
+        return((fromRank > toRank) ? (fromRank - toRank) : (toRank - fromRank));
+       }
+
+
+      /**
+       * Add business days to a day.
+       *
+       * @param[in] day Start day, which itself does not need to be a business day
+       * @param[in] businessDays Number of business days
+       * @return The businessDays-th business day after day, or day when businessDays is 0
+       * @throws std::out_of_range When day or the result is outside of the calendar
+       */
+      [[nodiscard]] auto addBusinessDays(const JD day, const unsigned long businessDays) const -> JD
+       {
+        const unsigned long index = this->index(day);
+        if (businessDays == 0)
+         {
+          return(day);
+         }
+        // Business days up to and including day
+        const unsigned long before = rank(index) + (((this->bits[index / 64] >> (index % 64)) & 1U) != 0 ? 1 : 0);
+        if (businessDays > this->ranks.back() - before)
+         {
+          throw std::out_of_range("result is outside of the calendar");
+         }
+        return(JD(this->first + select(before + businessDays - 1)));
+       }
+
+
+      /**
+       * Subtract business days from a day.
+       *
+       * @param[in] day Start day, which itself does not need to be a business day
+       * @param[in] businessDays Number of business days
+       * @return The businessDays-th business day before day, or day when businessDays is 0
+       * @throws std::out_of_range When day or the result is outside of the calendar
+       */
+      [[nodiscard]] auto subtractBusinessDays(const JD day, const unsigned long businessDays) const -> JD
+       {
+        const unsigned long index = this->index(day);
+        if (businessDays == 0)
+         {
+          return(day);
+         }
+        // Business days before day
+        const unsigned long before = rank(index);
+        if (businessDays > before)
+         {
+          throw std::out_of_range("result is outside of the calendar");
+         }
+        return(JD(this->first + select(before - businessDays)));
+       }
+
+    private:
+      unsigned long first;
+      unsigned long last;
+      std::vector<std::uint64_t> bits;
+      std::vector<unsigned long> ranks;
+
+
+      /**
+       * Index of a day within the calendar.
+       *
+       * @param[in] day Day
+       * @return Index (0-last-first)
+       * @throws std::out_of_range When day is outside of the calendar
+       */
+      [[nodiscard]] auto index(const JD day) const -> unsigned long
+       {
+        if ((day.getJD() < this->first) || (day.getJD() > this->last))
+         {
+          throw std::out_of_range("day is outside of the calendar");
+         }
+        return(day.getJD() - this->first);
+       }
+
+
+      /**
+       * Number of business days before a day.
+       *
+       * @param[in] day Day of the calendar or the day after its last day
+       * @return Number of business days
+       * @throws std::out_of_range When day is outside of the calendar and not the day after its last day
+       */
+      [[nodiscard]] auto rankOfBoundary(const JD day) const -> unsigned long
+       {
+        if (day.getJD() == this->last + 1)
+         {
+          return(this->ranks.back());
+         }
+        return(rank(this->index(day)));
+       }
+
+
+      /**
+       * Number of business days before an index.
+       *
+       * @param[in] index Index (0-last-first)
+       * @return Number of business days
+       */
+      [[nodiscard]] auto rank(const unsigned long index) const noexcept -> unsigned long
+       {
+        const std::uint64_t below = (std::uint64_t{1} << (index % 64)) - 1U;
+        return(this->ranks[index / 64] + popcount(this->bits[index / 64] & below));
+       }
+
+
+      /**
+       * Index of a business day.
+       *
+       * @param[in] rank Number of business days before the wanted one (0-number of business days - 1)
+       * @return Index (0-last-first)
+       */
+      [[nodiscard]] auto select(const unsigned long rank) const noexcept -> unsigned long
+       {
+        const auto word = static_cast<std::size_t>(std::upper_bound(this->ranks.cbegin(), this->ranks.cend(), rank) - this->ranks.cbegin() - 1);
+        return((word * 64UL) + selectBit(this->bits[word], static_cast<unsigned short>(rank - this->ranks[word])));
+       }
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_BUSINESSCALENDAR_H_
@@ -0,0 +1,532 @@
+/** @file
+ * Batch conversions for columns of dates.
+ * The kernels have no branches within their inner loops, so that compilers are able to vectorize them (SSE/AVX2/NEON).
+ * Instead of throwing exceptions they report invalid elements within a validity bitmask.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_DATEBATCH_H_
+#define DATELIB_DATEBATCH_H_
+
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include "Bits.h"
+#include "DayNumber.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Number of 64 bit words for a validity bitmask.
+   *
+   * @param[in] count Number of elements
+   * @return Number of words
+   */
+  [[nodiscard]] constexpr auto validityMaskWords(const std::size_t count) noexcept -> std::size_t
+   {
+    return((count + 63U) / 64U);
+   }
+
+
+  /**
+   * Number of elements per validity bitmask word, the kernels work in blocks of this size.
+   */
+  constexpr std::size_t validityBlockSize = 64;
+
+
+  /**
+   * Pack the flags of one block into a validity bitmask word.
+   *
+   * The kernels write one byte per element first, because that vectorizes and setting single bits does not.
+   *
+   * @param[in] flags Flags (0 or 1), unused flags must be 0
+   * @return Bitmask word, bit i is flags[i]
+   */
+  [[nodiscard]] constexpr auto packFlags(const std::array<unsigned char, validityBlockSize> &flags) noexcept -> std::uint64_t
+   {
+    std::uint64_t mask = 0;
+    for (std::size_t byte = 0; byte < validityBlockSize; byte += 8)
+     {
+      std::uint64_t word = 0;
+      for (std::size_t i = 0; i < 8; ++i)
+       {
+        word |= static_cast<std::uint64_t>(flags[byte + i]) << (8U * i);
+       }
+      mask |= packByteFlags(word) << byte;
+     }
+    return(mask);
+   }
+
+
+  /**
+   * Set the bits of a validity bitmask for all elements that are not 0.
+   *
+   * @param[in] values Values, where 0 marks an invalid element
+   * @param[in] count Number of values
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words
+   */
+  template<typename T> inline void nonZeroMask(const T *values, const std::size_t count, std::uint64_t *valid) noexcept
+   {
+    for (std::size_t block = 0; block < count; block += validityBlockSize)
+     {
+      const std::size_t size = (count - block < validityBlockSize) ? count - block : validityBlockSize;
+      std::array<unsigned char, validityBlockSize> flags {};
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        // Compare the 32 bit halves, SSE2 has no 64 bit compares
+        const auto value = static_cast<std::uint64_t>(values[block + i]);
+        flags[i] = ((static_cast<std::uint32_t>(value >> 32U) | static_cast<std::uint32_t>(value)) != 0) ? 1U : 0U;
+       }
+      valid[block / validityBlockSize] = packFlags(flags);
+     }
+   }
+
+
+  /**
+   * Branch free range check of a 64 bit value against a 32 bit range.
+   *
+   * Works on the 32 bit halves, because SSE2 has no 64 bit compares and the loops using it would not vectorize.
+   *
+   * @param[in] value Value
+   * @param[in] min Minimum value
+   * @param[in] max Maximum value (>= min)
+   * @return 1 when value is within min-max, otherwise 0
+   */
+  [[nodiscard]] constexpr auto inRange32(const unsigned long value, const std::uint32_t min, const std::uint32_t max) noexcept -> std::uint32_t
+   {
+    const std::uint32_t high = static_cast<std::uint32_t>(value >> 32U);
+    const std::uint32_t outside = ((static_cast<std::uint32_t>(value) - min) > (max - min)) ? 1U : 0U;
+    return(((high | outside) == 0) ? 1U : 0U);
+   }
+
+
+  /**
+   * Branch free JD number of a date in the julian calendar system.
+   *
+   * Works on 32 bit integers without multiplications and divisions, so that it vectorizes with SSE2.
+   * The days before a month and the month lengths are calculated instead of looked up, table gathers are slower.
+   * Invalid values are not clamped, the unsigned arithmetic wraps around and its result is masked out.
+   *
+   * @param[in] year Year (8-32767)
+   * @param[in] month Month (1-12)
+   * @param[in] day Day (1-31)
+   * @return JD number or 0 for an invalid date
+   */
+  [[nodiscard]] constexpr auto julianToJDOrZero(const long year, const unsigned short month, const unsigned short day) noexcept -> unsigned long
+   {
+    const std::uint32_t y = static_cast<std::uint32_t>(year);
+    const std::uint32_t m = month;
+    const std::uint32_t leap = ((y & 3U) == 0) ? 1U : 0U;
+    const std::uint32_t afterFebruary = (m > 2U) ? 1U : 0U;
+    const std::uint32_t february = (m == 2U) ? 1U : 0U;
+    // The months alternate between 31 and 30 days, the alternation restarts with august
+    const std::uint32_t alternation = m + (m >> 3U);
+    const std::uint32_t daysInMonth = 30U + (alternation & 1U) - (2U * february) + (february & leap);
+    const std::uint32_t daysBefore = (30U * (m - 1U)) + (alternation >> 1U) - (2U * afterFebruary) + (afterFebruary & leap);
+    const std::uint32_t ok = inRange32(static_cast<unsigned long>(year), 8U, 32767U) & (((m - 1U) <= 11U) ? 1U : 0U) & (((day - 1U) < daysInMonth) ? 1U : 0U);
+    const std::uint32_t jd = 1721423U + ((1461U * (y - 1U)) / 4U) + daysBefore + day;
+    return(jd * ok);
+   }
+
+
+  /**
+   * Branch free JD number of a date in the (proleptic) gregorian calendar system.
+   *
+   * Like julianToJDOrZero() with the additional century corrections, that need the only division (by 100).
+   *
+   * @param[in] year Year (1-32767)
+   * @param[in] month Month (1-12)
+   * @param[in] day Day (1-31)
+   * @return JD number or 0 for an invalid date
+   */
+  [[nodiscard]] constexpr auto gregorianToJDOrZero(const long year, const unsigned short month, const unsigned short day) noexcept -> unsigned long
+   {
+    const std::uint32_t y = static_cast<std::uint32_t>(year);
+    const std::uint32_t m = month;
+    const std::uint32_t century = y / 100U;
+    const std::uint32_t centuryYear = (y == (100U * century)) ? 1U : 0U;
+    // (y - 1) / 100
+    const std::uint32_t centuries = century - centuryYear;
+    // Divisible by 400, when divisible by 100 and 16
+    const std::uint32_t leap = (((y & 3U) == 0) ? 1U : 0U) & ((1U - centuryYear) | (((y & 15U) == 0) ? 1U : 0U));
+    const std::uint32_t afterFebruary = (m > 2U) ? 1U : 0U;
+    const std::uint32_t february = (m == 2U) ? 1U : 0U;
+    // The months alternate between 31 and 30 days, the alternation restarts with august
+    const std::uint32_t alternation = m + (m >> 3U);
+    const std::uint32_t daysInMonth = 30U + (alternation & 1U) - (2U * february) + (february & leap);
+    const std::uint32_t daysBefore = (30U * (m - 1U)) + (alternation >> 1U) - (2U * afterFebruary) + (afterFebruary & leap);
+    const std::uint32_t ok = inRange32(static_cast<unsigned long>(year), 1U, 32767U) & (((m - 1U) <= 11U) ? 1U : 0U) & (((day - 1U) < daysInMonth) ? 1U : 0U);
+    const std::uint32_t jd = 1721425U + ((1461U * (y - 1U)) / 4U) - centuries + (centuries / 4U) + daysBefore + day;
+    return(jd * ok);
+   }
+
+
+  /**
+   * Branch free date in the julian calendar system of a JD number.
+   *
+   * Works on 32 bit integers that are sufficient for the supported range.
+   *
+   * @param[in] jd JD number (8-01-01 - 32767-12-31)
+   * @return Year, month and day
+   */
+  [[nodiscard]] constexpr auto jdToJulian32(const std::uint32_t jd) noexcept -> YearMonthDay
+   {
+    const std::uint32_t c = jd + 32082U;
+    const std::uint32_t d = ((4U * c) + 3U) / 1461U;
+    const std::uint32_t e = c - ((1461U * d) / 4U);
+    const std::uint32_t m = ((5U * e) + 2U) / 153U;
+    const std::uint32_t m10 = m / 10U;
+    return(YearMonthDay{static_cast<long>(d + m10 - 4800U), static_cast<unsigned short>(m + 3U - (12U * m10)), static_cast<unsigned short>(e - (((153U * m) + 2U) / 5U) + 1U)});
+   }
+
+
+  /**
+   * Branch free date in the (proleptic) gregorian calendar system of a JD number.
+   *
+   * Works on 32 bit integers that are sufficient for the supported range.
+   *
+   * @param[in] jd JD number (1-01-01 - 32767-12-31)
+   * @return Year, month and day
+   */
+  [[nodiscard]] constexpr auto jdToGregorian32(const std::uint32_t jd) noexcept -> YearMonthDay
+   {
+    const std::uint32_t a = jd + 32044U;
+    const std::uint32_t b = ((4U * a) + 3U) / 146097U;
+    const std::uint32_t c = a - ((146097U * b) / 4U);
+    const std::uint32_t d = ((4U * c) + 3U) / 1461U;
+    const std::uint32_t e = c - ((1461U * d) / 4U);
+    const std::uint32_t m = ((5U * e) + 2U) / 153U;
+    const std::uint32_t m10 = m / 10U;
+    return(YearMonthDay{static_cast<long>((100U * b) + d + m10 - 4800U), static_cast<unsigned short>(m + 3U - (12U * m10)), static_cast<unsigned short>(e - (((153U * m) + 2U) / 5U) + 1U)});
+   }
+
+
+  /**
+   * Validate JD numbers against the supported range of the julian calendar system.
+   *
+   * @param[in] jds JD numbers
+   * @param[in] count Number of JD numbers
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words, bit i is set when jds[i] is within 8-01-01..32767-12-31
+   * @return Number of valid JD numbers
+   */
+  inline auto validateJulianJDs(const unsigned long *jds, const std::size_t count, std::uint64_t *valid) noexcept -> std::size_t
+   {
+    std::size_t validCount = 0;
+    for (std::size_t block = 0; block < count; block += 64)
+     {
+      const std::size_t size = (count - block < 64) ? count - block : 64;
+      std::uint64_t mask = 0;
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        mask |= static_cast<std::uint64_t>((jds[block + i] - minJulianJD) <= (maxJulianJD - minJulianJD)) << i;
+       }
+      valid[block / 64] = mask;
+      validCount += std::bitset<64>(mask).count();
+     }
+    return(validCount);
+   }
+
+
+  /**
+   * Decode JD numbers into years, months and days of the julian calendar system.
+   *
+   * Works on 32 bit integers that are sufficient for the supported range.
+   * Invalid JD numbers (< 8-01-01 or > 32767-12-31) result in 0 for year, month and day.
+   *
+   * @param[in] jds JD numbers
+   * @param[in] count Number of JD numbers
+   * @param[out] years Years (8-32767)
+   * @param[out] months Months (1-12)
+   * @param[out] days Days (1-31)
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words, see validateJulianJDs(); nullptr when not required
+   * @return Number of valid JD numbers
+   */
+  inline auto decodeJulianDates(const unsigned long *jds, const std::size_t count, long *years, unsigned short *months, unsigned short *days, std::uint64_t *valid) noexcept -> std::size_t
+   {
+    std::size_t validCount = 0;
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      const unsigned long jd = jds[i];
+      const unsigned long ok = ((jd - minJulianJD) <= (maxJulianJD - minJulianJD)) ? 1UL : 0UL;
+      const YearMonthDay ymd = jdToJulian32(static_cast<std::uint32_t>((ok != 0) ? jd : minJulianJD));
+      years[i] = ymd.year * static_cast<long>(ok);
+      months[i] = static_cast<unsigned short>(ymd.month * ok);
+      days[i] = static_cast<unsigned short>(ymd.day * ok);
+      validCount += ok;
+     }
+    if (valid != nullptr)
+     {
+      validateJulianJDs(jds, count, valid);
+     }
+    return(validCount);
+   }
+
+
+  /**
+   * Encode years, months and days of the julian calendar system into JD numbers.
+   *
+   * See julianToJDOrZero().
+   * Invalid dates (year < 8 or > 32767, month not 1-12, day not within the month) result in a JD number of 0.
+   *
+   * @param[in] years Years (8-32767)
+   * @param[in] months Months (1-12)
+   * @param[in] days Days (1-31)
+   * @param[in] count Number of dates
+   * @param[out] jds JD numbers
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words, bit i is set when the i-th date is valid; nullptr when not required
+   * @return Number of valid dates
+   */
+  inline auto encodeJulianDates(const long *years, const unsigned short *months, const unsigned short *days, const std::size_t count, unsigned long *jds, std::uint64_t *valid) noexcept -> std::size_t
+   {
+    std::size_t validCount = 0;
+    for (std::size_t block = 0; block < count; block += validityBlockSize)
+     {
+      const std::size_t size = (count - block < validityBlockSize) ? count - block : validityBlockSize;
+      std::array<unsigned char, validityBlockSize> flags {};
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        const unsigned long jd = julianToJDOrZero(years[block + i], months[block + i], days[block + i]);
+        jds[block + i] = jd;
+        // The JD numbers are < 2^32, a 64 bit compare would not vectorize with SSE2
+        flags[i] = (static_cast<std::uint32_t>(jd) != 0) ? 1U : 0U;
+       }
+      const std::uint64_t mask = packFlags(flags);
+      if (valid != nullptr)
+       {
+        valid[block / validityBlockSize] = mask;
+       }
+      validCount += popcount(mask);
+     }
+    return(validCount);
+   }
+
+
+  /**
+   * Decode JD numbers into years, months and days of the (proleptic) gregorian calendar system.
+   *
+   * Invalid JD numbers (< 1-01-01 or > 32767-12-31) result in 0 for year, month and day.
+   *
+   * @param[in] jds JD numbers
+   * @param[in] count Number of JD numbers
+   * @param[out] years Years (1-32767)
+   * @param[out] months Months (1-12)
+   * @param[out] days Days (1-31)
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words, bit i is set when jds[i] is within 1-01-01..32767-12-31; nullptr when not required
+   * @return Number of valid JD numbers
+   */
+  inline auto decodeGregorianDates(const unsigned long *jds, const std::size_t count, long *years, unsigned short *months, unsigned short *days, std::uint64_t *valid) noexcept -> std::size_t
+   {
+    std::size_t validCount = 0;
+    for (std::size_t block = 0; block < count; block += validityBlockSize)
+     {
+      const std::size_t size = (count - block < validityBlockSize) ? count - block : validityBlockSize;
+      std::array<unsigned char, validityBlockSize> flags {};
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        // Invalid JD numbers are decoded too, their garbage is masked out
+        const std::uint32_t ok = inRange32(jds[block + i], static_cast<std::uint32_t>(minGregorianJD), static_cast<std::uint32_t>(maxGregorianJD));
+        const YearMonthDay ymd = jdToGregorian32(static_cast<std::uint32_t>(jds[block + i]));
+        years[block + i] = static_cast<long>(static_cast<std::uint32_t>(ymd.year) * ok);
+        months[block + i] = static_cast<unsigned short>(ymd.month * ok);
+        days[block + i] = static_cast<unsigned short>(ymd.day * ok);
+        flags[i] = static_cast<unsigned char>(ok);
+       }
+      const std::uint64_t mask = packFlags(flags);
+      if (valid != nullptr)
+       {
+        valid[block / validityBlockSize] = mask;
+       }
+      validCount += popcount(mask);
+     }
+    return(validCount);
+   }
+
+
+  /**
+   * Encode years, months and days of the (proleptic) gregorian calendar system into JD numbers.
+   *
+   * See gregorianToJDOrZero().
+   * Invalid dates (year < 1 or > 32767, month not 1-12, day not within the month) result in a JD number of 0.
+   *
+   * @param[in] years Years (1-32767)
+   * @param[in] months Months (1-12)
+   * @param[in] days Days (1-31)
+   * @param[in] count Number of dates
+   * @param[out] jds JD numbers
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words, bit i is set when the i-th date is valid; nullptr when not required
+   * @return Number of valid dates
+   */
+  inline auto encodeGregorianDates(const long *years, const unsigned short *months, const unsigned short *days, const std::size_t count, unsigned long *jds, std::uint64_t *valid) noexcept -> std::size_t
+   {
+    std::size_t validCount = 0;
+    for (std::size_t block = 0; block < count; block += validityBlockSize)
+     {
+      const std::size_t size = (count - block < validityBlockSize) ? count - block : validityBlockSize;
+      std::array<unsigned char, validityBlockSize> flags {};
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        const unsigned long jd = gregorianToJDOrZero(years[block + i], months[block + i], days[block + i]);
+        jds[block + i] = jd;
+        // The JD numbers are < 2^32, a 64 bit compare would not vectorize with SSE2
+        flags[i] = (static_cast<std::uint32_t>(jd) != 0) ? 1U : 0U;
+       }
+      const std::uint64_t mask = packFlags(flags);
+      if (valid != nullptr)
+       {
+        valid[block / validityBlockSize] = mask;
+       }
+      validCount += popcount(mask);
+     }
+    return(validCount);
+   }
+
+
+  /**
+   * Convert dates of the julian calendar system into the (proleptic) gregorian calendar system.
+   *
+   * Encodes and decodes through the JD number within one pass, without an intermediate JD column.
+   * Invalid julian dates and dates that are > gregorian 32767-12-31 result in 0 for year, month and day.
+   * The input and output columns may be the same.
+   *
+   * @param[in] julianYears Julian years (8-32767)
+   * @param[in] julianMonths Julian months (1-12)
+   * @param[in] julianDays Julian days (1-31)
+   * @param[in] count Number of dates
+   * @param[out] years Gregorian years (1-32767)
+   * @param[out] months Gregorian months (1-12)
+   * @param[out] days Gregorian days (1-31)
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words, bit i is set when the i-th date has been converted; nullptr when not required
+   * @return Number of converted dates
+   */
+  inline auto julianToGregorianDates(const long *julianYears, const unsigned short *julianMonths, const unsigned short *julianDays, const std::size_t count, long *years, unsigned short *months, unsigned short *days, std::uint64_t *valid) noexcept -> std::size_t
+   {
+    std::size_t validCount = 0;
+    for (std::size_t block = 0; block < count; block += validityBlockSize)
+     {
+      const std::size_t size = (count - block < validityBlockSize) ? count - block : validityBlockSize;
+      std::array<unsigned char, validityBlockSize> flags {};
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        // All lanes stay 32 bit, invalid JD numbers are decoded too and their garbage is masked out
+        const auto jd = static_cast<std::uint32_t>(julianToJDOrZero(julianYears[block + i], julianMonths[block + i], julianDays[block + i]));
+        const std::uint32_t ok = inRange32(jd, static_cast<std::uint32_t>(minGregorianJD), static_cast<std::uint32_t>(maxGregorianJD));
+        const YearMonthDay ymd = jdToGregorian32(jd);
+        years[block + i] = static_cast<long>(static_cast<std::uint32_t>(ymd.year) * ok);
+        months[block + i] = static_cast<unsigned short>(ymd.month * ok);
+        days[block + i] = static_cast<unsigned short>(ymd.day * ok);
+        flags[i] = static_cast<unsigned char>(ok);
+       }
+      const std::uint64_t mask = packFlags(flags);
+      if (valid != nullptr)
+       {
+        valid[block / validityBlockSize] = mask;
+       }
+      validCount += popcount(mask);
+     }
+    return(validCount);
+   }
+
+
+  /**
+   * Convert dates of the (proleptic) gregorian calendar system into the julian calendar system.
+   *
+   * Encodes and decodes through the JD number within one pass, without an intermediate JD column.
+   * Invalid gregorian dates and dates that are < julian 8-01-01 result in 0 for year, month and day.
+   * The input and output columns may be the same.
+   *
+   * @param[in] gregorianYears Gregorian years (1-32767)
+   * @param[in] gregorianMonths Gregorian months (1-12)
+   * @param[in] gregorianDays Gregorian days (1-31)
+   * @param[in] count Number of dates
+   * @param[out] years Julian years (8-32767)
+   * @param[out] months Julian months (1-12)
+   * @param[out] days Julian days (1-31)
+   * @param[out] valid Validity bitmask with validityMaskWords(count) words, bit i is set when the i-th date has been converted; nullptr when not required
+   * @return Number of converted dates
+   */
+  inline auto gregorianToJulianDates(const long *gregorianYears, const unsigned short *gregorianMonths, const unsigned short *gregorianDays, const std::size_t count, long *years, unsigned short *months, unsigned short *days, std::uint64_t *valid) noexcept -> std::size_t
+   {
+    std::size_t validCount = 0;
+    for (std::size_t block = 0; block < count; block += validityBlockSize)
+     {
+      const std::size_t size = (count - block < validityBlockSize) ? count - block : validityBlockSize;
+      std::array<unsigned char, validityBlockSize> flags {};
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        // All lanes stay 32 bit, invalid JD numbers are decoded too and their garbage is masked out
+        const auto jd = static_cast<std::uint32_t>(gregorianToJDOrZero(gregorianYears[block + i], gregorianMonths[block + i], gregorianDays[block + i]));
+        const std::uint32_t ok = inRange32(jd, static_cast<std::uint32_t>(minJulianJD), static_cast<std::uint32_t>(maxJulianJD));
+        const YearMonthDay ymd = jdToJulian32(jd);
+        years[block + i] = static_cast<long>(static_cast<std::uint32_t>(ymd.year) * ok);
+        months[block + i] = static_cast<unsigned short>(ymd.month * ok);
+        days[block + i] = static_cast<unsigned short>(ymd.day * ok);
+        flags[i] = static_cast<unsigned char>(ok);
+       }
+      const std::uint64_t mask = packFlags(flags);
+      if (valid != nullptr)
+       {
+        valid[block / validityBlockSize] = mask;
+       }
+      validCount += popcount(mask);
+     }
+    return(validCount);
+   }
+
+
+  /**
+   * ISO weekdays of JD numbers.
+   *
+   * Only a modulo 7 on 32 bit integers, so that the loop vectorizes; the JD numbers must be < 2^32, that is far beyond 32767-12-31.
+   *
+   * @param[in] jds JD numbers
+   * @param[in] count Number of JD numbers
+   * @param[out] weekdays Weekdays (1-7 for monday to sunday)
+   */
+  inline void decodeWeekdays(const unsigned long *jds, const std::size_t count, unsigned short *weekdays) noexcept
+   {
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      weekdays[i] = static_cast<unsigned short>((static_cast<std::uint32_t>(jds[i]) % 7U) + 1U);
+     }
+   }
+
+
+  /**
+   * Select the JD numbers that are on one of the given weekdays.
+   *
+   * See decodeWeekdays() for the range of the JD numbers.
+   *
+   * @param[in] jds JD numbers
+   * @param[in] count Number of JD numbers
+   * @param[in] weekdays Set of weekdays, bit n is set for weekday n (1-7 for monday to sunday), i.e. 0xC0 for saturday and sunday
+   * @param[out] selected Bitmask with validityMaskWords(count) words, bit i is set when jds[i] is on one of the weekdays
+   * @return Number of selected JD numbers
+   */
+  inline auto selectWeekdays(const unsigned long *jds, const std::size_t count, const unsigned short weekdays, std::uint64_t *selected) noexcept -> std::size_t
+   {
+    // Bit n of the set is moved to bit n - 1, so that it is indexed by jd % 7
+    const std::uint32_t set = static_cast<std::uint32_t>(weekdays) >> 1U;
+    std::size_t selectedCount = 0;
+    for (std::size_t block = 0; block < count; block += 64)
+     {
+      const std::size_t size = (count - block < 64) ? count - block : 64;
+      std::uint64_t mask = 0;
+      for (std::size_t i = 0; i < size; ++i)
+       {
+        mask |= static_cast<std::uint64_t>((set >> (static_cast<std::uint32_t>(jds[block + i]) % 7U)) & 1U) << i;
+       }
+      selected[block / 64] = mask;
+      selectedCount += std::bitset<64>(mask).count();
+     }
+    return(selectedCount);
+   }
+
+ } // namespace
+
+#endif // DATELIB_DATEBATCH_H_
@@ -0,0 +1,273 @@
+/** @file
+ * Formatter for ISO 8601 dates (YYYY-MM-DD, YYYY-DDD and YYYY-Www-D), JD/MJD numbers and ISO 8601 durations (PnYnMnD).
+ * Works like std::to_chars: writes into caller buffers, no allocation, no locale and no exceptions.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_DATEFORMATTER_H_
+#define DATELIB_DATEFORMATTER_H_
+
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+#include "DayNumber.h"
+#include "JD.h"
+#include "MJD.h"
+#include "Duration.h"
+#include "JulianDate.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Build the two digit table.
+   *
+   * @return Characters of the numbers 00-99, two per number
+   */
+  [[nodiscard]] constexpr auto makeTwoDigitsTable() noexcept -> std::array<char, 200>
+   {
+    std::array<char, 200> table {};
+    for (std::size_t value = 0; value < 100; ++value)
+     {
+      table[2 * value] = static_cast<char>('0' + (value / 10));
+      table[(2 * value) + 1] = static_cast<char>('0' + (value % 10));
+     }
+    return(table);
+   }
+
+
+  /**
+   * Two digit numbers 00-99 for the formatters.
+   */
+  constexpr std::array<char, 200> twoDigits = makeTwoDigitsTable();
+
+
+  /**
+   * Write a two digit number.
+   *
+   * @param[out] pos Output position (2 characters)
+   * @param[in] value Number (0-99)
+   */
+  constexpr void writeTwoDigits(char *pos, const unsigned long value) noexcept
+   {
+    pos[0] = twoDigits[2 * value];
+    pos[1] = twoDigits[(2 * value) + 1];
+   }
+
+
+  /**
+   * Number of characters of a year.
+   *
+   * @param[in] year Year (0-99999)
+   * @return 4, or 5 for years > 9999
+   */
+  [[nodiscard]] constexpr auto yearLength(const unsigned long year) noexcept -> std::ptrdiff_t
+   {
+    return((year > 9999) ? 5 : 4);
+   }
+
+
+  /**
+   * Write a year with four digits, or five digits for years > 9999.
+   *
+   * @param[out] pos Output position (yearLength(year) characters)
+   * @param[in] year Year (0-99999)
+   * @return Pointer behind the year
+   */
+  constexpr auto writeYear(char *pos, const unsigned long year) noexcept -> char *
+   {
+    if (year > 9999)
+     {
+      *pos++ = static_cast<char>('0' + (year / 10000));
+     }
+    writeTwoDigits(pos, (year / 100) % 100);
+    writeTwoDigits(pos + 2, year % 100);
+    return(pos + 4);
+   }
+
+
+  /**
+   * Write a date as ISO 8601 calendar date YYYY-MM-DD.
+   *
+   * @param[in] first Begin of the buffer
+   * @param[in] last End of the buffer
+   * @param[in] date JulianDate
+   * @return Pointer behind the written characters and std::errc{}; last and std::errc::value_too_large when the buffer is too small, then nothing is written
+   */
+  inline auto toChars(char *first, char *last, const JulianDate &date) noexcept -> std::to_chars_result
+   {
+    const auto year = static_cast<unsigned long>(date.getYear().getYear());
+    if (last - first < yearLength(year) + 6)
+     {
+      return(std::to_chars_result{last, std::errc::value_too_large});
+     }
+    char *pos = writeYear(first, year);
+    pos[0] = '-';
+    writeTwoDigits(pos + 1, date.getMonth().getMonth());
+    pos[3] = '-';
+    writeTwoDigits(pos + 4, date.getDay().getDay());
+    return(std::to_chars_result{pos + 6, std::errc{}});
+   }
+
+
+  /**
+   * Write a date as ISO 8601 ordinal date YYYY-DDD.
+   *
+   * @param[in] first Begin of the buffer
+   * @param[in] last End of the buffer
+   * @param[in] date JulianDate
+   * @return Pointer behind the written characters and std::errc{}; last and std::errc::value_too_large when the buffer is too small, then nothing is written
+   */
+  inline auto toCharsOrdinal(char *first, char *last, const JulianDate &date) noexcept -> std::to_chars_result
+   {
+    const auto year = static_cast<unsigned long>(date.getYear().getYear());
+    if (last - first < yearLength(year) + 4)
+     {
+      return(std::to_chars_result{last, std::errc::value_too_large});
+     }
+    const unsigned long dayWithinYear = date.getDayWithinYear().getDays();
+    char *pos = writeYear(first, year);
+    pos[0] = '-';
+    pos[1] = static_cast<char>('0' + (dayWithinYear / 100));
+    writeTwoDigits(pos + 2, dayWithinYear % 100);
+    return(std::to_chars_result{pos + 4, std::errc{}});
+   }
+
+
+  /**
+   * Write a date as ISO 8601 week date YYYY-Www-D.
+   *
+   * The year is the week based year, that differs from the calendar year for days of the first week within december
+   * and days of the last week within january.
+   *
+   * @param[in] first Begin of the buffer
+   * @param[in] last End of the buffer
+   * @param[in] date JulianDate
+   * @return Pointer behind the written characters and std::errc{}; last and std::errc::value_too_large when the buffer is too small, then nothing is written
+   */
+  inline auto toCharsWeek(char *first, char *last, const JulianDate &date) noexcept -> std::to_chars_result
+   {
+    const unsigned short week = date.getWeek().getWeek();
+    const unsigned short month = date.getMonth().getMonth();
+    unsigned long year = static_cast<unsigned long>(date.getYear().getYear());
+    if ((month == 1) && (week >= 52))
+     {
+      --year;
+     }
+    else if ((month == 12) && (week == 1))
+     {
+      ++year;
+     }
+    if (last - first < yearLength(year) + 6)
+     {
+      return(std::to_chars_result{last, std::errc::value_too_large});
+     }
+    char *pos = writeYear(first, year);
+    pos[0] = '-';
+    pos[1] = 'W';
+    writeTwoDigits(pos + 2, week);
+    pos[4] = '-';
+    pos[5] = static_cast<char>('0' + jdToWeekday(julianToJD(date.getYear().getYear(), month, date.getDay().getDay())));
+    return(std::to_chars_result{pos + 6, std::errc{}});
+   }
+
+
+  /**
+   * Write a JD number.
+   *
+   * @param[in] first Begin of the buffer
+   * @param[in] last End of the buffer
+   * @param[in] jd JD
+   * @return See std::to_chars
+   */
+  inline auto toChars(char *first, char *last, const JD &jd) noexcept -> std::to_chars_result
+   {
+    return(std::to_chars(first, last, jd.getJD()));
+   }
+
+
+  /**
+   * Write a MJD number.
+   *
+   * @param[in] first Begin of the buffer
+   * @param[in] last End of the buffer
+   * @param[in] mjd MJD
+   * @return See std::to_chars
+   */
+  inline auto toChars(char *first, char *last, const MJD &mjd) noexcept -> std::to_chars_result
+   {
+    return(std::to_chars(first, last, mjd.getMJD()));
+   }
+
+
+  /**
+   * Write a duration as ISO 8601 duration PnYnMnD.
+   *
+   * Components that are zero are left out, an empty duration is written as P0D.
+   *
+   * @param[in] first Begin of the buffer
+   * @param[in] last End of the buffer
+   * @param[in] duration Duration
+   * @return Pointer behind the written characters and std::errc{}; last and std::errc::value_too_large when the buffer is too small
+   */
+  inline auto toChars(char *first, char *last, const Duration &duration) noexcept -> std::to_chars_result
+   {
+    const unsigned long values[] = {duration.getYears().getYears(), duration.getMonths().getMonths(), duration.getDays().getDays()};
+    constexpr char designators[] = {'Y', 'M', 'D'};
+    if (first == last)
+     {
+      return(std::to_chars_result{last, std::errc::value_too_large});
+     }
+    char *pos = first;
+    *pos++ = 'P';
+    for (std::size_t i = 0; i < 3; ++i)
+     {
+      if ((values[i] != 0) || ((i == 2) && (pos == first + 1)))
+       {
+        const std::to_chars_result result = std::to_chars(pos, last, values[i]);
+        if ((result.ec != std::errc{}) || (result.ptr == last))
+         {
+          return(std::to_chars_result{last, std::errc::value_too_large});
+         }
+        pos = result.ptr;
+        *pos++ = designators[i];
+       }
+     }
+    return(std::to_chars_result{pos, std::errc{}});
+   }
+
+
+  /**
+   * Write a column of dates as ISO 8601 calendar dates, each one followed by a separator.
+   *
+   * @param[in] first Begin of the buffer
+   * @param[in] last End of the buffer
+   * @param[in] dates JulianDates
+   * @param[in] count Number of dates
+   * @param[in] separator Character behind each date (i.e. '\n')
+   * @return Pointer behind the written characters and std::errc{}; pointer behind the last complete date and std::errc::value_too_large when the buffer is too small
+   */
+  inline auto toChars(char *first, char *last, const JulianDate *dates, const std::size_t count, const char separator) noexcept -> std::to_chars_result
+   {
+    char *pos = first;
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      const std::to_chars_result result = toChars(pos, last, dates[i]);
+      if ((result.ec != std::errc{}) || (result.ptr == last))
+       {
+        return(std::to_chars_result{pos, std::errc::value_too_large});
+       }
+      pos = result.ptr;
+      *pos++ = separator;
+     }
+    return(std::to_chars_result{pos, std::errc{}});
+   }
+
+ } // namespace
+
+#endif // DATELIB_DATEFORMATTER_H_
@@ -0,0 +1,216 @@
+/** @file
+ * Interval of days from a first to a last JD (inclusive).
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_DATEINTERVAL_H_
+#define DATELIB_DATEINTERVAL_H_
+
+
+#include <ostream>
+#include <stdexcept>
+#include "Days.h"
+#include "JD.h"
+#include "JulianDate.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Value class that represents the days from a first to a last day (inclusive).
+   *
+   * The days are kept as JD numbers, so that intervals of all calendar systems could be compared and combined.
+   */
+  class DateInterval final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] first First day
+       * @param[in] last Last day (inclusive)
+       * @throws std::out_of_range When first > last
+       */
+      constexpr DateInterval(const JD first, const JD last)
+       : first(first.getJD()), last(last.getJD())
+       {
+        if (this->first > this->last)
+         {
+          throw std::out_of_range("first > last");
+         }
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date (inclusive)
+       * @throws std::out_of_range When first > last
+       */
+      constexpr DateInterval(const JulianDate &first, const JulianDate &last)
+       : DateInterval(first.getJD(), last.getJD())
+       {
+       }
+
+
+      /**
+       * Get first day.
+       *
+       * @return First day
+       */
+      [[nodiscard]] constexpr auto getFirst() const noexcept -> JD
+       {
+        return(JD(this->first));
+       }
+
+
+      /**
+       * Get last day.
+       *
+       * @return Last day (inclusive)
+       */
+      [[nodiscard]] constexpr auto getLast() const noexcept -> JD
+       {
+        return(JD(this->last));
+       }
+
+
+      /**
+       * Get length.
+       *
+       * @return Number of days (1-ULONG_MAX)
+       */
+      [[nodiscard]] constexpr auto getLength() const noexcept -> Days
+       {
+        return(Days(this->last - this->first + 1));
+       }
+
+
+      /**
+       * Contains this interval a day.
+       *
+       * @param[in] day Day
+       * @return true when day is within this interval, false otherwise
+       */
+      [[nodiscard]] constexpr auto contains(const JD day) const noexcept -> bool
+       {
+        return((day.getJD() >= this->first) && (day.getJD() <= this->last));
+       }
+
+
+      /**
+       * Have this and another interval at least one day in common.
+       *
+       * @param[in] other Another interval
+       * @return true when the intervals overlap, false otherwise
+       */
+      [[nodiscard]] constexpr auto overlaps(const DateInterval &other) const noexcept -> bool
+       {
+        return((this->first <= other.last) && (other.first <= this->last));
+       }
+
+    private:
+      unsigned long first;
+      unsigned long last;
+
+   };
+
+
+  /** @relates DateInterval
+   * Operator equal to compare two DateInterval objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are equal in value.
+   */
+  [[nodiscard]] constexpr auto operator==(const DateInterval &lhs, const DateInterval &rhs) noexcept -> bool
+   {
+    return((lhs.getFirst() == rhs.getFirst()) && (lhs.getLast() == rhs.getLast()));
+   }
+
+
+  /** @relates DateInterval
+   * Operator not equal to compare two DateInterval objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are not equal in value.
+   */
+  [[nodiscard]] constexpr auto operator!=(const DateInterval &lhs, const DateInterval &rhs) noexcept -> bool
+   {
+    return(!(lhs == rhs));
+   }
+
+
+  /** @relates DateInterval
+   * Operator smaller to compare two DateInterval objects by first and then by last day.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<(const DateInterval &lhs, const DateInterval &rhs) noexcept -> bool
+   {
+    return((lhs.getFirst() < rhs.getFirst()) || ((lhs.getFirst() == rhs.getFirst()) && (lhs.getLast() < rhs.getLast())));
+   }
+
+
+  /** @relates DateInterval
+   * Operator greater to compare two DateInterval objects by first and then by last day.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>(const DateInterval &lhs, const DateInterval &rhs) noexcept -> bool
+   {
+    return(rhs < lhs);
+   }
+
+
+  /** @relates DateInterval
+   * Operator smaller or equal to compare two DateInterval objects by first and then by last day.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<=(const DateInterval &lhs, const DateInterval &rhs) noexcept -> bool
+   {
+    return(!(lhs > rhs));
+   }
+
+
+  /** @relates DateInterval
+   * Operator greater or equal to compare two DateInterval objects by first and then by last day.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>=(const DateInterval &lhs, const DateInterval &rhs) noexcept -> bool
+   {
+    return(!(lhs < rhs));
+   }
+
+
+  /** @relates DateInterval
+   * Stream operator to write a DateInterval to an output stream.
+   *
+   * @param[in] outs Output stream
+   * @param[in] obj DateInterval object to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& outs, const DateInterval &obj) -> std::ostream&
+   {
+    outs << "DateInterval(" << obj.getFirst().getJD() << ", " << obj.getLast().getJD() << ")";
+    return outs;
+   }
+
+ } // namespace
+
+#endif // DATELIB_DATEINTERVAL_H_
@@ -0,0 +1,309 @@
+/** @file
+ * Immutable index over date intervals for stabbing and overlap queries.
+ * The intervals are sorted by their first day and stored in one flat array that is an implicit binary tree
+ * (in-order layout, the node at index i is on level k when the lowest k bits of i are set), augmented by the
+ * maximum last day within every subtree. No pointers are stored and small subtrees are scanned linearly.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_DATEINTERVALINDEX_H_
+#define DATELIB_DATEINTERVALINDEX_H_
+
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "JD.h"
+#include "DateInterval.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Index over a fixed set of intervals.
+   *
+   * Queries report the position of the matching intervals within the array the index was built from,
+   * in order of the first day of the intervals.
+   */
+  class DateIntervalIndex final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] intervals Intervals in any order, could overlap
+       * @param[in] count Number of intervals
+       * @throws std::out_of_range When count is > 4294967295
+       */
+      DateIntervalIndex(const DateInterval *intervals, const std::size_t count)
+       {
+        if (count > UINT32_MAX)
+         {
+          throw std::out_of_range("count is > 4294967295");
+         }
+        this->ids.resize(count);
+        std::iota(this->ids.begin(), this->ids.end(), std::uint32_t{0});
+        std::sort(this->ids.begin(), this->ids.end(), [intervals](const std::uint32_t lhs, const std::uint32_t rhs) noexcept -> bool {return(intervals[lhs] < intervals[rhs]);});
+        this->nodes.reserve(count);
+        for (const std::uint32_t id : this->ids)
+         {
+          const unsigned long last = intervals[id].getLast().getJD();
+          this->nodes.push_back(Node{intervals[id].getFirst().getJD(), last, last});
+         }
+        augment();
+       }
+
+
+      /**
+       * Get number of intervals.
+       *
+       * @return Number of intervals
+       */
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+       {
+        return(this->nodes.size());
+       }
+
+
+      /**
+       * Find the intervals that contain a day.
+       *
+       * @param[in] day Day
+       * @param[in,out] result Positions of the matching intervals are appended
+       */
+      void findStabbing(const JD day, std::vector<std::uint32_t> &result) const
+       {
+        find(day.getJD(), day.getJD(), result);
+       }
+
+
+      /**
+       * Find the intervals that have at least one day in common with a range.
+       *
+       * @param[in] range Range of days
+       * @param[in,out] result Positions of the matching intervals are appended
+       */
+      void findOverlaps(const DateInterval &range, std::vector<std::uint32_t> &result) const
+       {
+        find(range.getFirst().getJD(), range.getLast().getJD(), result);
+       }
+
+
+      /**
+       * Find the intervals that contain a day for many sorted days.
+       *
+       * The matches of consecutive days are updated by a sweep (drop the intervals that ended, add the ones that started),
+       * a day that is far away from the previous one is answered by a tree query instead.
+       *
+       * @param[in] days Days in ascending order
+       * @param[in] count Number of days
+       * @param[in,out] result Positions of the matching intervals are appended
+       * @param[out] offsets count + 1 entries, the matches of days[i] are result[offsets[i]] to result[offsets[i + 1] - 1]
+       * @throws std::out_of_range When days are not sorted
+       */
+      void findStabbing(const JD *days, const std::size_t count, std::vector<std::uint32_t> &result, std::size_t *offsets) const
+       {
+        // Active intervals as node indices in ascending order
+        std::vector<std::uint32_t> active;
+        std::size_t started = 0;
+        unsigned long previous = 0;
+        for (std::size_t i = 0; i < count; ++i)
+         {
+          const unsigned long day = days[i].getJD();
+          if (day < previous)
+           {
+            throw std::out_of_range("days are not sorted");
+           }
+          previous = day;
+          const auto next = static_cast<std::size_t>(std::upper_bound(this->nodes.cbegin() + static_cast<std::ptrdiff_t>(started), this->nodes.cend(), day, [](const unsigned long value, const Node &node) noexcept -> bool {return(value < node.first);}) - this->nodes.cbegin());
+          if (next - started > (4 * active.size()) + 64)
+           {
+            active.clear();
+            findNodes(day, day, active);
+           }
+          else
+           {
+            active.erase(std::remove_if(active.begin(), active.end(), [this, day](const std::uint32_t node) noexcept -> bool {return(this->nodes[node].last < day);}), active.end());
+            for (std::size_t node = started; node < next; ++node)
+             {
+              if (this->nodes[node].last >= day)
+               {
+                active.push_back(static_cast<std::uint32_t>(node));
+               }
+             }
+           }
+          started = next;
+          offsets[i] = result.size();
+          for (const std::uint32_t node : active)
+           {
+            result.push_back(this->ids[node]);
+           }
+         }
+        offsets[count] = result.size();
+       }
+
+    private:
+      /**
+       * Interval with the maximum last day of its subtree.
+       */
+      struct Node final
+       {
+        /**
+         * First day.
+         */
+        unsigned long first;
+
+        /**
+         * Last day.
+         */
+        unsigned long last;
+
+        /**
+         * Maximum last day within the subtree of this node.
+         */
+        unsigned long maxLast;
+       };
+
+      /**
+       * Subtrees up to this level are scanned linearly.
+       */
+      static constexpr unsigned short scanLevel = 3;
+
+      std::vector<Node> nodes;
+      std::vector<std::uint32_t> ids;
+      unsigned short rootLevel = 0;
+
+
+      /**
+       * Calculate the maximum last days bottom up, level by level.
+       *
+       * Nodes behind the end of the array are missing, their subtrees use the maximum of the last real subtree.
+       */
+      void augment() noexcept
+       {
+        const std::size_t count = this->nodes.size();
+        if (count == 0)
+         {
+          return;
+         }
+        std::size_t lastIndex = 0;
+        unsigned long lastMax = 0;
+        for (std::size_t i = 0; i < count; i += 2)
+         {
+          lastIndex = i;
+          lastMax = this->nodes[i].last;
+         }
+        unsigned short level = 1;
+        for (; (std::size_t{1} << level) <= count; ++level)
+         {
+          const std::size_t half = std::size_t{1} << (level - 1U);
+          for (std::size_t i = (half << 1U) - 1; i < count; i += half << 2U)
+           {
+            const unsigned long right = (i + half < count) ? this->nodes[i + half].maxLast : lastMax;
+            this->nodes[i].maxLast = std::max({this->nodes[i].last, this->nodes[i - half].maxLast, right});
+           }
+          // Move to the parent of the last real subtree
+          lastIndex = (((lastIndex >> level) & 1U) != 0) ? (lastIndex - half) : (lastIndex + half);
+          if ((lastIndex < count) && (this->nodes[lastIndex].maxLast > lastMax))
+           {
+            lastMax = this->nodes[lastIndex].maxLast;
+           }
+         }
+        this->rootLevel = static_cast<unsigned short>(level - 1U);
+       }
+
+
+      /**
+       * Find overlapping nodes.
+       *
+       * @param[in] first First day of the range
+       * @param[in] last Last day of the range (inclusive)
+       * @param[in,out] result Indices of the matching nodes are appended in ascending order
+       */
+      void findNodes(const unsigned long first, const unsigned long last, std::vector<std::uint32_t> &result) const
+       {
+        const std::size_t count = this->nodes.size();
+        if (count == 0)
+         {
+          return;
+         }
+        struct Frame
+         {
+          std::size_t index;
+          unsigned short level;
+          bool visited;
+         };
+        std::array<Frame, 64> stack {};
+        std::size_t top = 0;
+        stack[top++] = Frame{(std::size_t{1} << this->rootLevel) - 1, this->rootLevel, false};
+        while (top > 0)
+         {
+          const Frame frame = stack[--top];
+          if (frame.level <= scanLevel)
+           {
+            const std::size_t begin = (frame.index >> frame.level) << frame.level;
+            const std::size_t end = std::min(begin + (std::size_t{1} << (frame.level + 1U)) - 1, count);
+            for (std::size_t i = begin; (i < end) && (this->nodes[i].first <= last); ++i)
+             {
+              if (this->nodes[i].last >= first)
+               {
+                result.push_back(static_cast<std::uint32_t>(i));
+               }
+             }
+           }
+          else if (!frame.visited)
+           {
+            // Revisit this node after its left subtree, skip the left subtree when all of it ends before first
+            const std::size_t left = frame.index - (std::size_t{1} << (frame.level - 1U));
+            stack[top++] = Frame{frame.index, frame.level, true};
+            if ((left >= count) || (this->nodes[left].maxLast >= first))
+             {
+              stack[top++] = Frame{left, static_cast<unsigned short>(frame.level - 1U), false};
+             }
+           }
+          else if ((frame.index < count) && (this->nodes[frame.index].first <= last))
+           {
+            if (this->nodes[frame.index].last >= first)
+             {
+              result.push_back(static_cast<std::uint32_t>(frame.index));
+             }
+            // Skip the right subtree when all of it ends before first
+            const std::size_t right = frame.index + (std::size_t{1} << (frame.level - 1U));
+            if ((right >= count) || (this->nodes[right].maxLast >= first))
+             {
+              stack[top++] = Frame{right, static_cast<unsigned short>(frame.level - 1U), false};
+             }
+           }
+         }
+       }
+
+
+      /**
+       * Find overlapping intervals.
+       *
+       * @param[in] first First day of the range
+       * @param[in] last Last day of the range (inclusive)
+       * @param[in,out] result Positions of the matching intervals are appended
+       */
+      void find(const unsigned long first, const unsigned long last, std::vector<std::uint32_t> &result) const
+       {
+        const std::size_t begin = result.size();
+        findNodes(first, last, result);
+        for (std::size_t i = begin; i < result.size(); ++i)
+         {
+          result[i] = this->ids[result[i]];
+         }
+       }
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_DATEINTERVALINDEX_H_
@@ -0,0 +1,397 @@
+/** @file
+ * Set of days stored as sorted, disjoint and not adjacent intervals within one contiguous vector.
+ * Union, intersection and difference walk both sets once, so they are linear in the number of intervals.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_DATEINTERVALSET_H_
+#define DATELIB_DATEINTERVALSET_H_
+
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+#include "Days.h"
+#include "JD.h"
+#include "DateInterval.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Set of days.
+   *
+   * Overlapping and adjacent intervals are merged, i.e. [1, 3] and [4, 5] become [1, 5].
+   */
+  class DateIntervalSet final
+   {
+    public:
+      /**
+       * Iterator over the intervals in ascending order.
+       */
+      using const_iterator = std::vector<DateInterval>::const_iterator;
+
+
+      /**
+       * Constructor for an empty set.
+       */
+      DateIntervalSet() noexcept = default;
+
+
+      /**
+       * Constructor.
+       *
+       * Sorted input is only merged, unsorted input will be sorted first.
+       *
+       * @param[in] intervals Intervals in any order, could overlap
+       * @param[in] count Number of intervals
+       */
+      DateIntervalSet(const DateInterval *intervals, const std::size_t count)
+       {
+        std::vector<DateInterval> sorted(intervals, intervals + count);
+        if (!std::is_sorted(sorted.cbegin(), sorted.cend()))
+         {
+          std::sort(sorted.begin(), sorted.end());
+         }
+        this->intervals.reserve(sorted.size());
+        for (const DateInterval &interval : sorted)
+         {
+          append(interval);
+         }
+        this->intervals.shrink_to_fit();
+       }
+
+
+      /**
+       * Get number of intervals.
+       *
+       * @return Number of disjoint intervals
+       */
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+       {
+        return(this->intervals.size());
+       }
+
+
+      /**
+       * Is set empty.
+       *
+       * @return true when the set contains no day, false otherwise
+       */
+      [[nodiscard]] auto empty() const noexcept -> bool
+       {
+        return(this->intervals.empty());
+       }
+
+
+      /**
+       * Get begin iterator.
+       *
+       * @return Iterator to the first interval
+       */
+      [[nodiscard]] auto begin() const noexcept -> const_iterator
+       {
+        return(this->intervals.cbegin());
+       }
+
+
+      /**
+       * Get end iterator.
+       *
+       * @return Iterator behind the last interval
+       */
+      [[nodiscard]] auto end() const noexcept -> const_iterator
+       {
+        return(this->intervals.cend());
+       }
+
+
+      /**
+       * Get interval by index.
+       *
+       * @param[in] index Index (0-size()-1)
+       * @return Interval
+       */
+      [[nodiscard]] auto operator[](const std::size_t index) const noexcept -> const DateInterval&
+       {
+        return(this->intervals[index]);
+       }
+
+
+      /**
+       * Get total length.
+       *
+       * @return Number of days within the set
+       */
+      [[nodiscard]] auto getTotalDays() const noexcept -> Days
+       {
+        unsigned long days = 0;
+        for (const DateInterval &interval : this->intervals)
+         {
+          days += interval.getLast().getJD() - interval.getFirst().getJD() + 1;
+         }
+        return(Days(days));
+       }
+
+
+      /**
+       * Get the gaps between the intervals.
+       *
+       * @return Days from the first to the last day of this set that are not in this set
+       */
+      [[nodiscard]] auto getGaps() const -> DateIntervalSet
+       {
+        DateIntervalSet result;
+        if (this->intervals.size() > 1)
+         {
+          result.intervals.reserve(this->intervals.size() - 1);
+          for (std::size_t i = 1; i < this->intervals.size(); ++i)
+           {
+            result.intervals.emplace_back(JD(this->intervals[i - 1].getLast().getJD() + 1), JD(this->intervals[i].getFirst().getJD() - 1));
+           }
+         }
+        return(result);
+       }
+
+
+      /**
+       * Contains the set a day.
+       *
+       * Binary search over the intervals.
+       *
+       * @param[in] day Day
+       * @return true when day is within the set, false otherwise
+       */
+      [[nodiscard]] auto contains(const JD day) const noexcept -> bool
+       {
+        const auto iter = std::upper_bound(this->intervals.cbegin(), this->intervals.cend(), day, [](const JD value, const DateInterval &interval) noexcept -> bool {return(value < interval.getFirst());});
+        return((iter != this->intervals.cbegin()) && (day <= (iter - 1)->getLast()));
+       }
+
+
+      /**
+       * Union of two sets.
+       *
+       * @param[in] lhs Left hand side set
+       * @param[in] rhs Right hand side set
+       * @return Days that are in lhs or rhs
+       */
+      [[nodiscard]] static auto unite(const DateIntervalSet &lhs, const DateIntervalSet &rhs) -> DateIntervalSet
+       {
+        DateIntervalSet result;
+        result.intervals.reserve(lhs.size() + rhs.size());
+        auto left = lhs.intervals.cbegin();
+        auto right = rhs.intervals.cbegin();
+        while ((left != lhs.intervals.cend()) && (right != rhs.intervals.cend()))
+         {
+          result.append((left->getFirst() <= right->getFirst()) ? *left++ : *right++);
+         }
+        for (; left != lhs.intervals.cend(); ++left)
+         {
+          result.append(*left);
+         }
+        for (; right != rhs.intervals.cend(); ++right)
+         {
+          result.append(*right);
+         }
+        return(result);
+       }
+
+
+      /**
+       * Intersection of two sets.
+       *
+       * @param[in] lhs Left hand side set
+       * @param[in] rhs Right hand side set
+       * @return Days that are in lhs and rhs
+       */
+      [[nodiscard]] static auto intersect(const DateIntervalSet &lhs, const DateIntervalSet &rhs) -> DateIntervalSet
+       {
+        DateIntervalSet result;
+        result.intervals.reserve(lhs.size() + rhs.size());
+        auto left = lhs.intervals.cbegin();
+        auto right = rhs.intervals.cbegin();
+        while ((left != lhs.intervals.cend()) && (right != rhs.intervals.cend()))
+         {
+          const unsigned long first = std::max(left->getFirst().getJD(), right->getFirst().getJD());
+          const unsigned long last = std::min(left->getLast().getJD(), right->getLast().getJD());
+          if (first <= last)
+           {
+            result.intervals.emplace_back(JD(first), JD(last));
+           }
+          if (left->getLast() < right->getLast())
+           {
+            ++left;
+           }
+          else
+           {
+            ++right;
+           }
+         }
+        return(result);
+       }
+
+
+      /**
+       * Difference of two sets.
+       *
+       * @param[in] lhs Left hand side set
+       * @param[in] rhs Right hand side set
+       * @return Days that are in lhs but not in rhs
+       */
+      [[nodiscard]] static auto subtract(const DateIntervalSet &lhs, const DateIntervalSet &rhs) -> DateIntervalSet
+       {
+        DateIntervalSet result;
+        result.intervals.reserve(lhs.size() + rhs.size());
+        auto right = rhs.intervals.cbegin();
+        for (const DateInterval &interval : lhs.intervals)
+         {
+          unsigned long first = interval.getFirst().getJD();
+          const unsigned long last = interval.getLast().getJD();
+          while ((right != rhs.intervals.cend()) && (right->getLast().getJD() < first))
+           {
+            ++right;
+           }
+          // Cut out all rhs intervals that overlap, the last one could overlap the next lhs interval too
+          bool rest = true;
+          for (auto cut = right; (cut != rhs.intervals.cend()) && (cut->getFirst().getJD() <= last); ++cut)
+           {
+            if (cut->getFirst().getJD() > first)
+             {
+              result.intervals.emplace_back(JD(first), JD(cut->getFirst().getJD() - 1));
+             }
+            if (cut->getLast().getJD() >= last)
+             {
+              rest = false;
+              break;
+             }
+            first = cut->getLast().getJD() + 1;
+           }
+          if (rest)
+           {
+            result.intervals.emplace_back(JD(first), JD(last));
+           }
+         }
+        return(result);
+       }
+
+    private:
+      std::vector<DateInterval> intervals;
+
+
+      /**
+       * Append an interval that does not start before the last interval, merge it when it overlaps or is adjacent.
+       *
+       * @param[in] interval Interval
+       */
+      void append(const DateInterval &interval)
+       {
+        if (!this->intervals.empty())
+         {
+          DateInterval &back = this->intervals.back();
+          const unsigned long backLast = back.getLast().getJD();
+          if ((interval.getFirst().getJD() <= backLast) || (interval.getFirst().getJD() - backLast == 1))
+           {
+            if (interval.getLast().getJD() > backLast)
+             {
+              back = DateInterval(back.getFirst(), interval.getLast());
+             }
+            return;
+           }
+         }
+        this->intervals.push_back(interval);
+       }
+
+   };
+
+
+  /** @relates DateIntervalSet
+   * Operator equal to compare two DateIntervalSet objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs contain the same days.
+   */
+  [[nodiscard]] inline auto operator==(const DateIntervalSet &lhs, const DateIntervalSet &rhs) noexcept -> bool
+   {
+    return(std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+   }
+
+
+  /** @relates DateIntervalSet
+   * Operator not equal to compare two DateIntervalSet objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs do not contain the same days.
+   */
+  [[nodiscard]] inline auto operator!=(const DateIntervalSet &lhs, const DateIntervalSet &rhs) noexcept -> bool
+   {
+    return(!(lhs == rhs));
+   }
+
+
+  /** @relates DateIntervalSet
+   * Operator or for the union of two sets.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New DateIntervalSet object
+   */
+  [[nodiscard]] inline auto operator|(const DateIntervalSet &lhs, const DateIntervalSet &rhs) -> DateIntervalSet
+   {
+    return(DateIntervalSet::unite(lhs, rhs));
+   }
+
+
+  /** @relates DateIntervalSet
+   * Operator and for the intersection of two sets.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New DateIntervalSet object
+   */
+  [[nodiscard]] inline auto operator&(const DateIntervalSet &lhs, const DateIntervalSet &rhs) -> DateIntervalSet
+   {
+    return(DateIntervalSet::intersect(lhs, rhs));
+   }
+
+
+  /** @relates DateIntervalSet
+   * Operator minus for the difference of two sets.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New DateIntervalSet object
+   */
+  [[nodiscard]] inline auto operator-(const DateIntervalSet &lhs, const DateIntervalSet &rhs) -> DateIntervalSet
+   {
+    return(DateIntervalSet::subtract(lhs, rhs));
+   }
+
+
+  /** @relates DateIntervalSet
+   * Stream operator to write a DateIntervalSet to an output stream.
+   *
+   * @param[in] outs Output stream
+   * @param[in] obj DateIntervalSet object to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& outs, const DateIntervalSet &obj) -> std::ostream&
+   {
+    outs << "DateIntervalSet(";
+    for (const DateInterval &interval : obj)
+     {
+      outs << interval;
+     }
+    outs << ")";
+    return outs;
+   }
+
+ } // namespace
+
+#endif // DATELIB_DATEINTERVALSET_H_
@@ -0,0 +1,246 @@
+/** @file
+ * Parser for ISO 8601 dates (YYYY-MM-DD, YYYY-DDD and YYYY-Www-D) of the julian calendar system.
+ * Works like std::from_chars: no allocation, no locale and no exceptions.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_DATEPARSER_H_
+#define DATELIB_DATEPARSER_H_
+
+
+#include <charconv>
+#include <cstdint>
+#include <system_error>
+#include "DayNumber.h"
+#include "JD.h"
+#include "MJD.h"
+#include "JulianDate.h"
+#include "Unchecked.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Parse a number with a fixed count of decimal digits.
+   *
+   * @param[in] first Begin of the digits
+   * @param[in] last End of the text
+   * @param[in] count Number of digits
+   * @param[out] value Parsed number
+   * @return true: count digits have been parsed, false: otherwise
+   */
+  constexpr auto parseDigits(const char *first, const char *last, const unsigned short count, unsigned long &value) noexcept -> bool
+   {
+    if (last - first < count)
+     {
+      return(false);
+     }
+    unsigned long result = 0;
+    for (unsigned short i = 0; i < count; ++i)
+     {
+      const unsigned char digit = static_cast<unsigned char>(first[i] - '0');
+      if (digit > 9)
+       {
+        return(false);
+       }
+      result = (result * 10UL) + digit;
+     }
+    value = result;
+    return(true);
+   }
+
+
+  /**
+   * Parse the fixed width form YYYY-MM-DD.
+   *
+   * The eight bytes YYYY-MM- are checked at once within a 64 bit word (SWAR), so that the common case needs only a few branches.
+   *
+   * @param[in] first Begin of the text (at least 10 characters)
+   * @param[out] year Year (0-9999)
+   * @param[out] month Month (0-99)
+   * @param[out] day Day (0-99)
+   * @return true: the text has the fixed width form, false: otherwise
+   */
+  inline auto parseFixedWidthDate(const char *first, unsigned long &year, unsigned long &month, unsigned long &day) noexcept -> bool
+   {
+    std::uint64_t chunk = 0;
+    for (unsigned short i = 0; i < 8; ++i)
+     {
+      chunk |= static_cast<std::uint64_t>(static_cast<unsigned char>(first[i])) << (8U * i);
+     }
+    constexpr std::uint64_t dashMask = 0xFF0000FF00000000ULL;
+    if ((chunk & dashMask) != 0x2D00002D00000000ULL)
+     {
+      return(false);
+     }
+    const std::uint64_t digits = (chunk & ~dashMask) | 0x3000003000000000ULL;
+    if (((digits & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL) || (((digits + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL))
+     {
+      return(false);
+     }
+    const unsigned char day1 = static_cast<unsigned char>(first[8] - '0');
+    const unsigned char day2 = static_cast<unsigned char>(first[9] - '0');
+    if ((day1 > 9) || (day2 > 9))
+     {
+      return(false);
+     }
+    const std::uint64_t values = digits - 0x3030303030303030ULL;
+    // Combine neighboured digits into two digit numbers within the 16 bit lanes
+    const std::uint64_t pairs = ((values * 10U) + (values >> 8U)) & 0x00FF00FF00FF00FFULL;
+    year = static_cast<unsigned long>(((pairs & 0xFFU) * 100U) + ((pairs >> 16U) & 0xFFU));
+    month = static_cast<unsigned long>((((values >> 40U) & 0xFFU) * 10U) + ((values >> 48U) & 0xFFU));
+    day = (day1 * 10UL) + day2;
+    return(true);
+   }
+
+
+  /**
+   * Parse an ISO 8601 date of the julian calendar system into its JD number.
+   *
+   * Supported forms are YYYY-MM-DD, YYYY-DDD (day within year) and YYYY-Www-D (week and weekday),
+   * the year could also have five digits (up to 32767).
+   *
+   * @param[in] first Begin of the text
+   * @param[in] last End of the text
+   * @param[out] jd JD number, only written on success
+   * @return Pointer behind the date and std::errc{} on success; first and std::errc::invalid_argument when there is no date; pointer behind the date and std::errc::result_out_of_range when the date does not exist or is < 8-01-01
+   */
+  inline auto parseJulianJD(const char *first, const char *last, unsigned long &jd) noexcept -> std::from_chars_result
+   {
+    unsigned long year = 0;
+    unsigned long month = 0;
+    unsigned long day = 0;
+    const char *pos = first;
+    if ((last - first >= 10) && parseFixedWidthDate(first, year, month, day) && ((last - first == 10) || (static_cast<unsigned char>(first[10] - '0') > 9)))
+     {
+      pos = first + 10;
+     }
+    else
+     {
+      const unsigned short yearDigits = ((last - first >= 5) && (static_cast<unsigned char>(first[4] - '0') <= 9)) ? 5 : 4;
+      if (!parseDigits(first, last, yearDigits, year) || (pos + yearDigits == last) || (pos[yearDigits] != '-'))
+       {
+        return(std::from_chars_result{first, std::errc::invalid_argument});
+       }
+      pos += yearDigits + 1;
+      if ((pos != last) && (*pos == 'W'))
+       {
+        unsigned long week = 0;
+        unsigned long weekday = 0;
+        if (!parseDigits(pos + 1, last, 2, week) || (pos + 3 == last) || (pos[3] != '-') || !parseDigits(pos + 4, last, 1, weekday))
+         {
+          return(std::from_chars_result{first, std::errc::invalid_argument});
+         }
+        pos += 5;
+        // 8-01-01 is within the last week of the week based year 7
+        if ((year < 7) || (year > 32767) || (week < 1) || (week > julianWeeksInYear(static_cast<long>(year))) || (weekday < 1) || (weekday > 7))
+         {
+          return(std::from_chars_result{pos, std::errc::result_out_of_range});
+         }
+        // January 4th is always within the first week
+        const unsigned long jan4 = julianToJD(static_cast<long>(year), 1, 4);
+        const unsigned long result = jan4 - (jdToWeekday(jan4) - 1UL) + ((week - 1UL) * 7UL) + (weekday - 1UL);
+        if ((result < minJulianJD) || (result > maxJulianJD))
+         {
+          return(std::from_chars_result{pos, std::errc::result_out_of_range});
+         }
+        jd = result;
+        return(std::from_chars_result{pos, std::errc{}});
+       }
+      if (parseDigits(pos, last, 3, day) && ((pos + 3 == last) || (static_cast<unsigned char>(pos[3] - '0') > 9)))
+       {
+        pos += 3;
+        if ((year < 8) || (year > 32767) || (day < 1) || (day > (((year % 4) == 0) ? 366UL : 365UL)))
+         {
+          return(std::from_chars_result{pos, std::errc::result_out_of_range});
+         }
+        jd = julianToJD(static_cast<long>(year), 1, 1) + (day - 1UL);
+        return(std::from_chars_result{pos, std::errc{}});
+       }
+      if (!parseDigits(pos, last, 2, month) || (pos + 2 == last) || (pos[2] != '-') || !parseDigits(pos + 3, last, 2, day))
+       {
+        return(std::from_chars_result{first, std::errc::invalid_argument});
+       }
+      pos += 5;
+     }
+    if ((year < 8) || (year > 32767) || (month < 1) || (month > 12) || (day < 1) || (day > daysOfMonth[month] + (((month == 2) && ((year % 4) == 0)) ? 1UL : 0UL)))
+     {
+      return(std::from_chars_result{pos, std::errc::result_out_of_range});
+     }
+    jd = julianToJD(static_cast<long>(year), static_cast<unsigned short>(month), static_cast<unsigned short>(day));
+    return(std::from_chars_result{pos, std::errc{}});
+   }
+
+
+  /**
+   * Parse an ISO 8601 date into a JulianDate.
+   *
+   * @param[in] first Begin of the text
+   * @param[in] last End of the text
+   * @param[out] value JulianDate, only written on success
+   * @return See parseJulianJD()
+   */
+  inline auto fromChars(const char *first, const char *last, JulianDate &value) noexcept -> std::from_chars_result
+   {
+    unsigned long jd = 0;
+    const std::from_chars_result result = parseJulianJD(first, last, jd);
+    if (result.ec == std::errc{})
+     {
+      value = JulianDate(unchecked, JD(jd));
+     }
+    return(result);
+   }
+
+
+  /**
+   * Parse an ISO 8601 date of the julian calendar system into a JD.
+   *
+   * @param[in] first Begin of the text
+   * @param[in] last End of the text
+   * @param[out] value JD, only written on success
+   * @return See parseJulianJD()
+   */
+  inline auto fromChars(const char *first, const char *last, JD &value) noexcept -> std::from_chars_result
+   {
+    unsigned long jd = 0;
+    const std::from_chars_result result = parseJulianJD(first, last, jd);
+    if (result.ec == std::errc{})
+     {
+      value = JD(jd);
+     }
+    return(result);
+   }
+
+
+  /**
+   * Parse an ISO 8601 date of the julian calendar system into a MJD.
+   *
+   * @param[in] first Begin of the text
+   * @param[in] last End of the text
+   * @param[out] value MJD, only written on success
+   * @return See parseJulianJD(), additionally std::errc::result_out_of_range for dates before the MJD epoch
+   */
+  inline auto fromChars(const char *first, const char *last, MJD &value) noexcept -> std::from_chars_result
+   {
+    unsigned long jd = 0;
+    std::from_chars_result result = parseJulianJD(first, last, jd);
+    if (result.ec == std::errc{})
+     {
+      if (jd < 2400001UL)
+       {
+        result.ec = std::errc::result_out_of_range;
+       }
+      else
+       {
+        value = MJD(jd - 2400001UL);
+       }
+     }
+    return(result);
+   }
+
+ } // namespace
+
+#endif // DATELIB_DATEPARSER_H_
@@ -0,0 +1,399 @@
+/** @file
+ * Serial day numbers (JD) for calendar dates.
+ * All calendar date arithmetic is done on these numbers to get constant time operations.
+ * Because all calendar systems share the same numbers, a conversion between them is an encode into and a decode from a JD number.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_DAYNUMBER_H_
+#define DATELIB_DAYNUMBER_H_
+
+
+#include <array>
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Year, month and day of a calendar date as primitive data types.
+   */
+  struct YearMonthDay final
+   {
+    /**
+     * Year.
+     */
+    long year;
+
+    /**
+     * Month (1-12).
+     */
+    unsigned short month;
+
+    /**
+     * Day (1-31).
+     */
+    unsigned short day;
+   };
+
+
+  /**
+   * JD of the first supported julian date 8-01-01.
+   */
+  constexpr unsigned long minJulianJD = 1723980UL;
+
+  /**
+   * JD of the last supported julian date 32767-12-31.
+   */
+  constexpr unsigned long maxJulianJD = 13689569UL;
+
+  /**
+   * JD of the first supported (proleptic) gregorian date 1-01-01.
+   */
+  constexpr unsigned long minGregorianJD = 1721426UL;
+
+  /**
+   * JD of the last supported gregorian date 32767-12-31.
+   */
+  constexpr unsigned long maxGregorianJD = 13689325UL;
+
+
+  /**
+   * Days before the first day of a month (1-12) within a common year, index 0 is unused and index 13 is the length of the year.
+   */
+  constexpr std::array<unsigned long, 14> daysBeforeMonth {0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365};
+
+  /**
+   * Days before the first day of a month (1-12) within a leap year, index 0 is unused and index 13 is the length of the year.
+   */
+  constexpr std::array<unsigned long, 14> daysBeforeMonthInLeapYear {0, 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366};
+
+  /**
+   * Days of a month (1-12) within a common year, index 0 is unused.
+   */
+  constexpr std::array<unsigned long, 13> daysOfMonth {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+
+  /**
+   * Serial day number (JD) of a date in the julian calendar system.
+   *
+   * March based year, so that the leap day is the last day of the (shifted) year.
+   *
+   * @param[in] year Year (8-32767)
+   * @param[in] month Month (1-12)
+   * @param[in] day Day (1-31)
+   * @return JD number
+   */
+  [[nodiscard]] constexpr auto julianToJD(const long year, const unsigned short month, const unsigned short day) noexcept -> unsigned long
+   {
+    const unsigned long shift = (month < 3) ? 1UL : 0UL;
+    const unsigned long myear = static_cast<unsigned long>(year) + 4800UL - shift;
+    const unsigned long mmonth = month + (12UL * shift) - 3UL;
+    return(day + (((153UL * mmonth) + 2UL) / 5UL) + (365UL * myear) + (myear / 4UL) - 32083UL);
+   }
+
+
+  /**
+   * Date in the julian calendar system of a serial day number (JD).
+   *
+   * Integer only inverse of julianToJD() that calculates year, month and day in one pass.
+   *
+   * @param[in] jd JD number
+   * @return Year, month and day
+   */
+  [[nodiscard]] constexpr auto jdToJulian(const unsigned long jd) noexcept -> YearMonthDay
+   {
+    const unsigned long c = jd + 32082UL;
+    const unsigned long d = ((4UL * c) + 3UL) / 1461UL;
+    const unsigned long e = c - ((1461UL * d) / 4UL);
+    const unsigned long m = ((5UL * e) + 2UL) / 153UL;
+    return(YearMonthDay{static_cast<long>(d + (m / 10UL)) - 4800L, static_cast<unsigned short>(m + 3UL - (12UL * (m / 10UL))), static_cast<unsigned short>(e - (((153UL * m) + 2UL) / 5UL) + 1UL)});
+   }
+
+
+  /**
+   * ISO weekday of a serial day number (JD).
+   *
+   * @param[in] jd JD number
+   * @return Weekday (1-7 for monday to sunday)
+   */
+  [[nodiscard]] constexpr auto jdToWeekday(const unsigned long jd) noexcept -> unsigned short
+   {
+    return(static_cast<unsigned short>((jd % 7UL) + 1UL));
+   }
+
+
+  /**
+   * Number of years after which the weekdays of the julian calendar system repeat (solar cycle).
+   */
+  constexpr unsigned long julianSolarCycle = 28UL;
+
+
+  /**
+   * Build the julian year table.
+   *
+   * Each entry holds the weekday of january 1st (bits 0-2), the 53 weeks flag (bit 3) and the days from the monday of the first ISO week to january 4th (bits 4-6).
+   *
+   * @return Attributes for each year within the solar cycle
+   */
+  [[nodiscard]] constexpr auto makeJulianYearTable() noexcept -> std::array<unsigned char, julianSolarCycle>
+   {
+    std::array<unsigned char, julianSolarCycle> table {};
+    for (unsigned long index = 0; index < julianSolarCycle; ++index)
+     {
+      const long year = static_cast<long>(index + julianSolarCycle);
+      const unsigned short firstWeekday = jdToWeekday(julianToJD(year, 1, 1));
+      const bool weeks53 = (firstWeekday == 4) || (((year % 4) == 0) && (firstWeekday == 3));
+      table[index] = static_cast<unsigned char>(firstWeekday | (weeks53 ? 0x08U : 0U) | (((firstWeekday + 2U) % 7U) << 4U));
+     }
+    return(table);
+   }
+
+
+  /**
+   * Attributes of the julian years, index is the year modulo julianSolarCycle.
+   */
+  constexpr std::array<unsigned char, julianSolarCycle> julianYearTable = makeJulianYearTable();
+
+
+  /**
+   * JD number of january 1st of a year in the julian calendar system.
+   *
+   * @param[in] year Year (8-32767)
+   * @return JD number
+   */
+  [[nodiscard]] constexpr auto julianFirstJD(const long year) noexcept -> unsigned long
+   {
+    const unsigned long years = static_cast<unsigned long>(year) - 1UL;
+    return(1721424UL + (365UL * years) + (years / 4UL));
+   }
+
+
+  /**
+   * ISO weekday of january 1st of a year in the julian calendar system.
+   *
+   * @param[in] year Year (8-32767)
+   * @return Weekday (1-7 for monday to sunday)
+   */
+  [[nodiscard]] constexpr auto julianFirstWeekday(const long year) noexcept -> unsigned short
+   {
+    return(julianYearTable[static_cast<unsigned long>(year) % julianSolarCycle] & 0x07U);
+   }
+
+
+  /**
+   * Days from the monday of the first ISO week to january 4th of a year in the julian calendar system.
+   *
+   * January 4th is always within the first week, so that this is the weekday of january 4th minus one.
+   *
+   * @param[in] year Year (8-32767)
+   * @return Days (0-6)
+   */
+  [[nodiscard]] constexpr auto julianFirstWeekShift(const long year) noexcept -> unsigned short
+   {
+    return(static_cast<unsigned short>(julianYearTable[static_cast<unsigned long>(year) % julianSolarCycle] >> 4U));
+   }
+
+
+  /**
+   * Number of ISO weeks within a year of the julian calendar system.
+   *
+   * A year has 53 weeks when it starts on a thursday, or on a wednesday within a leap year.
+   *
+   * @param[in] year Year (8-32767)
+   * @return Number of weeks (52|53)
+   */
+  [[nodiscard]] constexpr auto julianWeeksInYear(const long year) noexcept -> unsigned short
+   {
+    return(((julianYearTable[static_cast<unsigned long>(year) % julianSolarCycle] & 0x08U) != 0) ? 53 : 52);
+   }
+
+
+  /**
+   * Day within year of a date in the julian calendar system.
+   *
+   * @param[in] year Year (8-32767)
+   * @param[in] month Month (1-12)
+   * @param[in] day Day (1-31)
+   * @return Day within year (1-366)
+   */
+  [[nodiscard]] constexpr auto julianDayWithinYear(const long year, const unsigned short month, const unsigned short day) noexcept -> unsigned short
+   {
+    const std::array<unsigned long, 14> &daysBefore = ((year % 4) == 0) ? daysBeforeMonthInLeapYear : daysBeforeMonth;
+    return(static_cast<unsigned short>(daysBefore[month] + day));
+   }
+
+
+  /**
+   * Date in the julian calendar system of a day within year.
+   *
+   * Inverse of julianDayWithinYear(), the month is estimated from the day within year and corrected by at most one month.
+   *
+   * @param[in] year Year (8-32767)
+   * @param[in] dayWithinYear Day within year (1-365 or 1-366 within leap years)
+   * @return Year, month and day
+   */
+  [[nodiscard]] constexpr auto julianFromDayWithinYear(const long year, const unsigned short dayWithinYear) noexcept -> YearMonthDay
+   {
+    const std::array<unsigned long, 14> &daysBefore = ((year % 4) == 0) ? daysBeforeMonthInLeapYear : daysBeforeMonth;
+    unsigned short month = static_cast<unsigned short>(((dayWithinYear - 1U) / 32U) + 1U);
+    if (dayWithinYear > daysBefore[month + 1U])
+     {
+      ++month;
+     }
+    return(YearMonthDay{year, month, static_cast<unsigned short>(dayWithinYear - daysBefore[month])});
+   }
+
+
+  /**
+   * Number of years after which the julian easter dates repeat (19 year lunar cycle times 28 year solar cycle).
+   */
+  constexpr unsigned long julianEasterCycle = 532UL;
+
+
+  /**
+   * Build the julian easter table.
+   *
+   * @return Easter as days after march 22nd (0-34) for each year within the cycle
+   */
+  [[nodiscard]] constexpr auto makeJulianEasterTable() noexcept -> std::array<unsigned char, julianEasterCycle>
+   {
+    std::array<unsigned char, julianEasterCycle> table {};
+    for (unsigned long year = 0; year < julianEasterCycle; ++year)
+     {
+      const unsigned long a = ((19UL * (year % 19UL)) + 15UL) % 30UL;
+      const unsigned long b = ((2UL * (year % 4UL)) + (4UL * (year % 7UL)) + 34UL - a) % 7UL;
+      table[year] = static_cast<unsigned char>(a + b);
+     }
+    return(table);
+   }
+
+
+  /**
+   * Julian easter as days after march 22nd, index is the year modulo julianEasterCycle.
+   */
+  constexpr std::array<unsigned char, julianEasterCycle> julianEasterTable = makeJulianEasterTable();
+
+
+  /**
+   * Easter sunday in the julian calendar system.
+   *
+   * One table lookup instead of the computus.
+   *
+   * @param[in] year Year (8-32767)
+   * @return Year, month and day of easter sunday (march 22nd - april 25th)
+   */
+  [[nodiscard]] constexpr auto julianEaster(const long year) noexcept -> YearMonthDay
+   {
+    const unsigned short offset = julianEasterTable[static_cast<unsigned long>(year) % julianEasterCycle];
+    const unsigned short april = (offset >= 10U) ? 1U : 0U;
+    return(YearMonthDay{year, static_cast<unsigned short>(3U + april), static_cast<unsigned short>(offset + 22U - (31U * april))});
+   }
+
+
+  /**
+   * Is leap year within the gregorian calendar system.
+   *
+   * @param[in] year Year (1-32767)
+   * @return true: leap year, false: otherwise
+   */
+  [[nodiscard]] constexpr auto isGregorianLeapYear(const long year) noexcept -> bool
+   {
+    return(((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0)));
+   }
+
+
+  /**
+   * Serial day number (JD) of a date in the (proleptic) gregorian calendar system.
+   *
+   * March based year like julianToJD() with the additional century corrections.
+   *
+   * @param[in] year Year (1-32767)
+   * @param[in] month Month (1-12)
+   * @param[in] day Day (1-31)
+   * @return JD number
+   */
+  [[nodiscard]] constexpr auto gregorianToJD(const long year, const unsigned short month, const unsigned short day) noexcept -> unsigned long
+   {
+    const unsigned long shift = (month < 3) ? 1UL : 0UL;
+    const unsigned long myear = static_cast<unsigned long>(year) + 4800UL - shift;
+    const unsigned long mmonth = month + (12UL * shift) - 3UL;
+    return(day + (((153UL * mmonth) + 2UL) / 5UL) + (365UL * myear) + (myear / 4UL) - (myear / 100UL) + (myear / 400UL) - 32045UL);
+   }
+
+
+  /**
+   * Date in the (proleptic) gregorian calendar system of a serial day number (JD).
+   *
+   * Integer only inverse of gregorianToJD() that calculates year, month and day in one pass.
+   *
+   * @param[in] jd JD number
+   * @return Year, month and day
+   */
+  [[nodiscard]] constexpr auto jdToGregorian(const unsigned long jd) noexcept -> YearMonthDay
+   {
+    const unsigned long a = jd + 32044UL;
+    const unsigned long b = ((4UL * a) + 3UL) / 146097UL;
+    const unsigned long c = a - ((146097UL * b) / 4UL);
+    const unsigned long d = ((4UL * c) + 3UL) / 1461UL;
+    const unsigned long e = c - ((1461UL * d) / 4UL);
+    const unsigned long m = ((5UL * e) + 2UL) / 153UL;
+    return(YearMonthDay{static_cast<long>((100UL * b) + d + (m / 10UL)) - 4800L, static_cast<unsigned short>(m + 3UL - (12UL * (m / 10UL))), static_cast<unsigned short>(e - (((153UL * m) + 2UL) / 5UL) + 1UL)});
+   }
+
+
+  /**
+   * Number of ISO weeks within a year of the gregorian calendar system.
+   *
+   * A year has 53 weeks when it starts on a thursday, or on a wednesday within a leap year.
+   *
+   * @param[in] year Year (0-32767)
+   * @return Number of weeks (52|53)
+   */
+  [[nodiscard]] constexpr auto gregorianWeeksInYear(const long year) noexcept -> unsigned short
+   {
+    const unsigned short firstWeekday = jdToWeekday(gregorianToJD(year, 1, 1));
+    return(((firstWeekday == 4) || (isGregorianLeapYear(year) && (firstWeekday == 3))) ? 53 : 52);
+   }
+
+
+  /**
+   * Day within year of a date in the gregorian calendar system.
+   *
+   * @param[in] year Year (1-32767)
+   * @param[in] month Month (1-12)
+   * @param[in] day Day (1-31)
+   * @return Day within year (1-366)
+   */
+  [[nodiscard]] constexpr auto gregorianDayWithinYear(const long year, const unsigned short month, const unsigned short day) noexcept -> unsigned short
+   {
+    const std::array<unsigned long, 14> &daysBefore = isGregorianLeapYear(year) ? daysBeforeMonthInLeapYear : daysBeforeMonth;
+    return(static_cast<unsigned short>(daysBefore[month] + day));
+   }
+
+
+  /**
+   * Date in the gregorian calendar system of a day within year.
+   *
+   * Inverse of gregorianDayWithinYear(), see julianFromDayWithinYear().
+   *
+   * @param[in] year Year (1-32767)
+   * @param[in] dayWithinYear Day within year (1-365 or 1-366 within leap years)
+   * @return Year, month and day
+   */
+  [[nodiscard]] constexpr auto gregorianFromDayWithinYear(const long year, const unsigned short dayWithinYear) noexcept -> YearMonthDay
+   {
+    const std::array<unsigned long, 14> &daysBefore = isGregorianLeapYear(year) ? daysBeforeMonthInLeapYear : daysBeforeMonth;
+    unsigned short month = static_cast<unsigned short>(((dayWithinYear - 1U) / 32U) + 1U);
+    if (dayWithinYear > daysBefore[month + 1U])
+     {
+      ++month;
+     }
+    return(YearMonthDay{year, month, static_cast<unsigned short>(dayWithinYear - daysBefore[month])});
+   }
+
+ } // namespace
+
+#endif // DATELIB_DAYNUMBER_H_
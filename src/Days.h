@@ -60,7 +60,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another days object to be assigned to this object.
        * @return Days
        */
-      auto operator=(const Days &other) & noexcept -> Days& = delete;
+      constexpr auto operator=(const Days &other) & noexcept -> Days& = default;
 
       /**
        * Move assignment operator for another Days object.
@@ -68,7 +68,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another days object to be assigned to this object.
        * @return Days&
        */
-      auto operator=(Days&& other) & noexcept -> Days& = delete;
+      constexpr auto operator=(Days&& other) & noexcept -> Days& = default;
 
 
       /**
@@ -82,7 +82,7 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const unsigned long days;
+      unsigned long days;
    };
 
 
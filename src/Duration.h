@@ -68,7 +68,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another duration object to be assigned to this object.
        */
-      auto operator=(const Duration &other) & noexcept -> Duration& = delete;
+      constexpr auto operator=(const Duration &other) & noexcept -> Duration& = default;
 
       /**
        * Move assignment operator for another Duration object.
@@ -76,7 +76,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another duration object to be assigned to this object.
        * @return Duration&
        */
-      auto operator=(Duration&& other) & noexcept -> Duration& = delete;
+      constexpr auto operator=(Duration&& other) & noexcept -> Duration& = default;
 
 
       /**
@@ -112,9 +112,9 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const Years years;
-      const Months months;
-      const Days days;
+      Years years;
+      Months months;
+      Days days;
    };
 
 
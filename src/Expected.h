@@ -0,0 +1,148 @@
+/** @file
+ * An Expected is the result of a non throwing validation (tryMake) factory.
+ * It holds either a valid value object or the ValidationError why the value object could not be created.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_EXPECTED_H_
+#define DATELIB_EXPECTED_H_
+
+
+#include <cassert>
+#include <variant>
+#include "ValidationError.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Value or validation error, without allocation and without exceptions.
+   *
+   * Both are kept within one variant, so that the state could not disagree with the stored value.
+   *
+   * @tparam T Value class
+   */
+  template <typename T>
+  class Expected final
+   {
+    public:
+      /**
+       * Constructor for a valid value.
+       *
+       * @param[in] value Value object
+       */
+      constexpr explicit Expected(const T &value) noexcept
+       : state{value}
+       {
+       }
+
+
+      /**
+       * Constructor for a validation error.
+       *
+       * Passing ValidationError::None is only checked with assertions within debug builds.
+       *
+       * @param[in] error Validation error (not ValidationError::None)
+       */
+      constexpr explicit Expected(const ValidationError error) noexcept
+       : state{error}
+       {
+        assert(error != ValidationError::None);
+       }
+
+
+      /**
+       * Copy constructor.
+       *
+       * @param[in] other Another Expected object to copy from.
+       */
+      constexpr Expected(const Expected &other) noexcept = default;
+
+      /**
+       * Move constructor.
+       *
+       * @param[in] other Another Expected object to move from.
+       */
+      constexpr Expected(Expected&& other) noexcept = default;
+
+      /**
+       * Destructor.
+       */
+      ~Expected() noexcept = default;
+
+      /**
+       * Assignment operator for another Expected object.
+       *
+       * @param[in] other Another Expected object to be assigned to this object.
+       * @return Expected&
+       */
+      constexpr auto operator=(const Expected &other) & noexcept -> Expected& = default;
+
+      /**
+       * Move assignment operator for another Expected object.
+       *
+       * @param[in] other Another Expected object to be assigned to this object.
+       * @return Expected&
+       */
+      constexpr auto operator=(Expected&& other) & noexcept -> Expected& = default;
+
+
+      /**
+       * Has a valid value.
+       *
+       * @return true: valid value, false: validation error
+       */
+      [[nodiscard]] constexpr auto hasValue() const noexcept -> bool
+       {
+        return(std::holds_alternative<T>(this->state));
+       }
+
+
+      /**
+       * Has a valid value.
+       *
+       * @return true: valid value, false: validation error
+       */
+      [[nodiscard]] constexpr explicit operator bool() const noexcept
+       {
+        return(hasValue());
+       }
+
+
+      /**
+       * Get value.
+       *
+       * Only allowed when hasValue() is true, which is only checked with assertions within debug builds.
+       *
+       * @return Value object
+       */
+      [[nodiscard]] constexpr auto getValue() const noexcept -> const T&
+       {
+        assert(hasValue());
+        return(*std::get_if<T>(&this->state));
+       }
+
+
+      /**
+       * Get validation error.
+       *
+       * @return Validation error, ValidationError::None when there is a valid value
+       */
+      [[nodiscard]] constexpr auto getError() const noexcept -> ValidationError
+       {
+        const ValidationError *error = std::get_if<ValidationError>(&this->state);
+        return((error == nullptr) ? ValidationError::None : *error);
+       }
+
+
+    private:
+      std::variant<T, ValidationError> state;
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_EXPECTED_H_
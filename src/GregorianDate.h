@@ -0,0 +1,767 @@
+/** @file
+ * A Date is a representation of a year-month-day.
+ * So it could have a value between 1-01-01 and 32767-12-31 (proleptic for dates before 1582-10-15)
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_GREGORIANDATE_H_
+#define DATELIB_GREGORIANDATE_H_
+
+
+#include <ostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include "Weekdays.h"
+#include "Days.h"
+#include "Months.h"
+#include "Years.h"
+#include "Weeks.h"
+#include "Duration.h"
+#include "JD.h"
+#include "DayNumber.h"
+#include "GregorianDay.h"
+#include "GregorianMonth.h"
+#include "GregorianYear.h"
+#include "GregorianWeek.h"
+#include "JulianDate.h"
+#include "Expected.h"
+#include "Unchecked.h"
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Value class that represents a date in the gregorian calendar system.
+   */
+  class GregorianDate final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] year Year
+       * @param[in] month Month depending on the year
+       * @param[in] day Day depending on the month
+       * @throws std::out_of_range Date is < 1-1-1 or > 32767-12-31
+       */
+      constexpr explicit GregorianDate(const GregorianYear year, const GregorianMonth month, const GregorianDay day)
+       : year(year), month(month), day(day)
+       {
+        const GregorianMonth checkMonth = GregorianMonth(year, month.getMonth());
+        const Days daysInMonth = checkMonth.getDaysInMonth();
+        if (day.getDay() > daysInMonth.getDays())
+         {
+          throw std::out_of_range("day is > " + std::to_string(daysInMonth.getDays()));
+         }
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] jd JD
+       */
+      constexpr explicit GregorianDate(const JD jd)
+       : GregorianDate(jdToGregorian(jd.getJD()))
+       {
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * Converts a date of the julian calendar system via its JD.
+       *
+       * @param[in] date JulianDate
+       * @throws std::out_of_range Date is > 32767-12-31
+       */
+      constexpr explicit GregorianDate(const JulianDate &date)
+       : GregorianDate(jdToGregorian(julianToJD(date.getYear().getYear(), date.getMonth().getMonth(), date.getDay().getDay())))
+       {
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] year Year
+       * @param[in] dayWithinYear Day within year (1-365 or 1-366 within leap years)
+       * @throws std::out_of_range When dayWithinYear is < 1 or > days within year
+       */
+      constexpr explicit GregorianDate(const GregorianYear year, const Days dayWithinYear)
+       : GregorianDate([](const GregorianYear year, const Days dayWithinYear) constexpr -> YearMonthDay {const unsigned long daysInYear = year.isLeapYear() ? 366 : 365; if ((dayWithinYear.getDays() < 1) || (dayWithinYear.getDays() > daysInYear)) {throw std::out_of_range("day within year is < 1 or > " + std::to_string(daysInYear));} return gregorianFromDayWithinYear(year.getYear(), static_cast<unsigned short>(dayWithinYear.getDays()));}(year, dayWithinYear))
+       {
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] year Year number (1-32767)
+       * @param[in] month Month number (1-12)
+       * @param[in] day Day number (1 - max days in month) depending on year and month
+       */
+      constexpr explicit GregorianDate([[maybe_unused]] const Unchecked tag, const long year, const unsigned short month, const unsigned short day) noexcept
+       : year(unchecked, year), month(unchecked, this->year, month), day(unchecked, day)
+       {
+        assert(day <= daysOfMonth[month] + (((month == 2) && isGregorianLeapYear(year)) ? 1U : 0U));
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] jd JD (1-01-01 - 32767-12-31)
+       */
+      constexpr explicit GregorianDate(const Unchecked tag, const JD jd) noexcept
+       : GregorianDate(tag, jdToGregorian(jd.getJD()))
+       {
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] year Year number (1-32767)
+       * @param[in] month Month number (1-12)
+       * @param[in] day Day number (1 - max days in month) depending on year and month
+       * @return GregorianDate or ValidationError::YearOutOfRange, ValidationError::MonthOutOfRange, ValidationError::DayOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const long year, const unsigned short month, const unsigned short day) noexcept -> Expected<GregorianDate>
+       {
+        if (year < 1 || year > 32767)
+         {
+          return(Expected<GregorianDate>(ValidationError::YearOutOfRange));
+         }
+        if (month < 1 || month > 12)
+         {
+          return(Expected<GregorianDate>(ValidationError::MonthOutOfRange));
+         }
+        if (day < 1 || day > daysOfMonth[month] + (((month == 2) && isGregorianLeapYear(year)) ? 1U : 0U))
+         {
+          return(Expected<GregorianDate>(ValidationError::DayOutOfRange));
+         }
+        return(Expected<GregorianDate>(GregorianDate(unchecked, year, month, day)));
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] jd JD
+       * @return GregorianDate or ValidationError::JDOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const JD jd) noexcept -> Expected<GregorianDate>
+       {
+        if (jd.getJD() < minGregorianJD || jd.getJD() > maxGregorianJD)
+         {
+          return(Expected<GregorianDate>(ValidationError::JDOutOfRange));
+         }
+        return(Expected<GregorianDate>(GregorianDate(unchecked, jd)));
+       }
+
+
+      /**
+       * Copy constructor.
+       *
+       * @param[in] other Another Date object to copy from.
+       */
+      constexpr GregorianDate(const GregorianDate &other) noexcept = default;
+
+      /**
+       * Move constructor.
+       *
+       * @param[in] other Another Date object to move from.
+       */
+      constexpr GregorianDate(GregorianDate&& other) noexcept = default;
+
+      /**
+       * Destructor.
+       */
+      ~GregorianDate() noexcept = default;
+
+      /**
+       * Assignment operator for another Date object.
+       *
+       * @param[in] other Another date object to be assigned to this object.
+       */
+      constexpr auto operator=(const GregorianDate &other) & noexcept -> GregorianDate& = default;
+
+      /**
+       * Move assignment operator for another Date object.
+       *
+       * @param[in] other Another date object to be assigned to this object.
+       * @return GregorianDate&
+       */
+      constexpr auto operator=(GregorianDate&& other) & noexcept -> GregorianDate& = default;
+
+
+      /**
+       * Get year as data type.
+       *
+       * @return GregorianYear (1-32767)
+       */
+      [[nodiscard]] constexpr auto getYear() const noexcept -> GregorianYear
+       {
+        return(this->year);
+       }
+
+
+      /**
+       * Get month as data type.
+       *
+       * @return GregorianMonth (1-12)
+       */
+      [[nodiscard]] constexpr auto getMonth() const noexcept -> GregorianMonth
+       {
+        return(this->month);
+       }
+
+
+      /**
+       * Get day as data type.
+       *
+       * @return GregorianDay (1-31)
+       */
+      [[nodiscard]] constexpr auto getDay() const noexcept -> GregorianDay
+       {
+        return(this->day);
+       }
+
+
+      /**
+       * Get weekday as data type.
+       *
+       * @return Weekday
+       */
+      [[nodiscard]] constexpr auto getWeekday() const noexcept -> Weekdays
+       {
+        return(getJD().getWeekday());
+       }
+
+
+      /**
+       * Get the Day within Year
+       *
+       * @return Days (1-366)
+       */
+      [[nodiscard]] constexpr auto getDayWithinYear() const noexcept -> Days
+       {
+        return(Days(gregorianDayWithinYear(this->year.getYear(), this->month.getMonth(), this->day.getDay())));
+       }
+
+
+      /**
+       * Get week as data type.
+       *
+       * @return GregorianWeek (1-53)
+       */
+      [[nodiscard]] constexpr auto getWeek() const -> GregorianWeek
+       {
+        const long dayWithinYear = static_cast<long>(getDayWithinYear().getDays());
+        const long weekday = jdToWeekday(getJD().getJD());
+        const long week = (dayWithinYear - weekday + 10) / 7;
+        if (week < 1)
+         {
+          return(GregorianWeek(gregorianWeeksInYear(this->year.getYear() - 1)));
+         }
+        if (week > gregorianWeeksInYear(this->year.getYear()))
+         {
+          return(GregorianWeek(1));
+         }
+        return(GregorianWeek(static_cast<unsigned short>(week)));
+       }
+
+
+      /**
+       * Get JD as data type.
+       *
+       * @return JD
+       */
+      [[nodiscard]] constexpr auto getJD() const noexcept -> JD
+       {
+        return(JD(gregorianToJD(this->year.getYear(), this->month.getMonth(), this->day.getDay())));
+       }
+
+
+      /**
+       * Get the same day within the julian calendar system.
+       *
+       * @return JulianDate
+       * @throws std::out_of_range Date is < julian 8-01-01
+       */
+      [[nodiscard]] constexpr auto getJulianDate() const -> JulianDate
+       {
+        const unsigned long jd = gregorianToJD(this->year.getYear(), this->month.getMonth(), this->day.getDay());
+        if (jd < minJulianJD)
+         {
+          throw std::out_of_range("julian year will be < 8");
+         }
+        return(JulianDate(unchecked, JD(jd)));
+       }
+
+    private:
+      /**
+       * Constructor.
+       *
+       * @param[in] ymd Decoded year, month and day
+       * @throws std::out_of_range Date is < 1-1-1 or > 32767-12-31
+       */
+      constexpr explicit GregorianDate(const YearMonthDay ymd)
+       : year(ymd.year), month(year, ymd.month), day(ymd.day)
+       {
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] ymd Decoded year, month and day
+       */
+      constexpr explicit GregorianDate(const Unchecked tag, const YearMonthDay ymd) noexcept
+       : GregorianDate(tag, ymd.year, ymd.month, ymd.day)
+       {
+       }
+
+
+      GregorianYear year;
+      GregorianMonth month;
+      GregorianDay day;
+
+   };
+
+
+  /** @relates GregorianDate
+   * Operator equal to compare two Date objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are equal in value.
+   */
+  [[nodiscard]] constexpr auto operator==(const GregorianDate &lhs, const GregorianDate &rhs) noexcept -> bool
+   {
+    return((lhs.getYear() == rhs.getYear()) && (lhs.getMonth() == rhs.getMonth()) && (lhs.getDay() == rhs.getDay()));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator not equal to compare two Date objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are not equal in value.
+   */
+  [[nodiscard]] constexpr auto operator!=(const GregorianDate &lhs, const GregorianDate &rhs) noexcept -> bool
+   {
+    return(!(lhs == rhs));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator smaller to compare two Date objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<(const GregorianDate &lhs, const GregorianDate &rhs) noexcept -> bool
+   {
+    bool result = lhs.getYear() < rhs.getYear();
+    if (!result && (lhs.getYear() == rhs.getYear()))
+     {
+      result = lhs.getMonth() < rhs.getMonth();
+      if (!result && (lhs.getMonth() == rhs.getMonth()))
+       {
+        result = lhs.getDay() < rhs.getDay();
+       }
+     }
+    return(result);
+   }
+
+
+  /** @relates GregorianDate
+   * Operator greater to compare two Date objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>(const GregorianDate &lhs, const GregorianDate &rhs) noexcept -> bool
+   {
+    return(rhs < lhs);
+   }
+
+
+  /** @relates GregorianDate
+   * Operator smaller or equal to compare two Date objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<=(const GregorianDate &lhs, const GregorianDate &rhs) noexcept -> bool
+   {
+    return(!(lhs > rhs));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator greater or equal to compare two Date objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>=(const GregorianDate &lhs, const GregorianDate &rhs) noexcept -> bool
+   {
+    return(!(lhs < rhs));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator plus to add a Years value to a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianDate &lhs, const Years &rhs) -> GregorianDate
+   {
+    return(GregorianDate(lhs.getYear() + rhs, lhs.getMonth(), lhs.getDay()));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator minus to subtract a Years value from a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDate &lhs, const Years &rhs) -> GregorianDate
+   {
+    return(GregorianDate(lhs.getYear() - rhs, lhs.getMonth(), lhs.getDay()));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator plus to add a Months value to a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   * @throws std::out_of_range When Date will become > 32767-12-31 or the day does not exist within the new month
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianDate &lhs, const Months &rhs) -> GregorianDate
+   {
+    const unsigned long months = (static_cast<unsigned long>(lhs.getYear().getYear()) * 12UL) + (lhs.getMonth().getMonth() - 1UL);
+    if (rhs.getMonths() > (32767UL * 12UL) + 11UL - months)
+     {
+      throw std::out_of_range("year will be > 32767");
+     }
+    const unsigned long total = months + rhs.getMonths();
+    return(GregorianDate(GregorianYear(static_cast<long>(total / 12UL)), GregorianMonth(static_cast<unsigned short>((total % 12UL) + 1UL)), lhs.getDay()));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator minus to subtract a Months value from a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   * @throws std::out_of_range When Date will become < 1-01-01 or the day does not exist within the new month
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDate &lhs, const Months &rhs) -> GregorianDate
+   {
+    const unsigned long months = (static_cast<unsigned long>(lhs.getYear().getYear()) * 12UL) + (lhs.getMonth().getMonth() - 1UL);
+    if (rhs.getMonths() > months - 12UL)
+     {
+      throw std::out_of_range("year will be < 1");
+     }
+    const unsigned long total = months - rhs.getMonths();
+    return(GregorianDate(GregorianYear(static_cast<long>(total / 12UL)), GregorianMonth(static_cast<unsigned short>((total % 12UL) + 1UL)), lhs.getDay()));
+   }
+
+
+  /** @relates GregorianDate
+   * Day difference when subtract a Date value from a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Days object
+   */
+  [[nodiscard]] constexpr auto dayDiff(const GregorianDate &lhs, const GregorianDate &rhs) noexcept -> Days
+   {
+    const unsigned long jd1 = gregorianToJD(lhs.getYear().getYear(), lhs.getMonth().getMonth(), lhs.getDay().getDay());
+    const unsigned long jd2 = gregorianToJD(rhs.getYear().getYear(), rhs.getMonth().getMonth(), rhs.getDay().getDay());
+    if (jd1 > jd2)
+     {
+      return(Days(jd1 - jd2));
+     }
+    return(Days(jd2 - jd1));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator plus to add a Days value to a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   * @throws std::out_of_range When Date will become > 32767-12-31
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianDate &lhs, const Days &rhs) -> GregorianDate
+   {
+    const unsigned long jd = gregorianToJD(lhs.getYear().getYear(), lhs.getMonth().getMonth(), lhs.getDay().getDay());
+    if (rhs.getDays() > maxGregorianJD - jd)
+     {
+      throw std::out_of_range("year will be > 32767");
+     }
+    return(GregorianDate(unchecked, JD(jd + rhs.getDays())));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator minus to subtract a Days value from a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   * @throws std::out_of_range When Date will become < 1-01-01
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDate &lhs, const Days &rhs) -> GregorianDate
+   {
+    const unsigned long jd = gregorianToJD(lhs.getYear().getYear(), lhs.getMonth().getMonth(), lhs.getDay().getDay());
+    if (rhs.getDays() > jd - minGregorianJD)
+     {
+      throw std::out_of_range("year will be < 1");
+     }
+    return(GregorianDate(unchecked, JD(jd - rhs.getDays())));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator plus to add a Weeks value to a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianDate &lhs, const Weeks &rhs) -> GregorianDate
+   {
+    return(lhs + Days(rhs.getWeeks() * 7));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator minus to subtract a Weeks value from a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDate &lhs, const Weeks &rhs) -> GregorianDate
+   {
+    return(lhs - Days(rhs.getWeeks() * 7));
+   }
+
+
+  /** @relates GregorianDate
+   * Operator plus to add a Duration value to a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianDate &lhs, const Duration &rhs) -> GregorianDate
+   {
+    long year = lhs.getYear().getYear();
+    unsigned short month = lhs.getMonth().getMonth();
+    unsigned short day = lhs.getDay().getDay();
+    year += rhs.getYears().getYears();
+    month +=  rhs.getMonths().getMonths();
+    if (month > 12)
+     {
+      month -= 12;
+      ++year;
+     }
+    if (GregorianMonth(GregorianYear(year), month).getDaysInMonth().getDays() < day)
+     {
+      day = 1;
+      ++month;
+     }
+    const GregorianDate newDate1 = GregorianDate(GregorianYear(year), GregorianMonth(month), GregorianDay(day));
+    return(newDate1 + rhs.getDays());
+   }
+
+
+  /** @relates GregorianDate
+   * Operator minus to subtract a Duration value from a Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDate &lhs, const Duration &rhs) -> GregorianDate
+   {
+    long year = lhs.getYear().getYear();
+    unsigned short month = lhs.getMonth().getMonth();
+    unsigned short day = lhs.getDay().getDay();
+    year -= rhs.getYears().getYears();
+    if (const unsigned short months = rhs.getMonths().getMonths(); month > months)
+     {
+      month -= months;
+     }
+    else
+     {
+      month += 12 - months;
+      --year;
+     }
+    if (GregorianMonth(GregorianYear(year), month).getDaysInMonth().getDays() < day)
+     {
+      day = GregorianMonth(GregorianYear(year), month).getDaysInMonth().getDays();
+     }
+    const GregorianDate newDate1 = GregorianDate(GregorianYear(year), GregorianMonth(month), GregorianDay(day));
+    return(newDate1 - rhs.getDays());
+   }
+
+
+  /** @relates GregorianDate
+   * Operator plus to move to the next (or same) Weekday Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianDate &lhs, const Weekdays &rhs) -> GregorianDate
+   {
+    const Weekdays wday = lhs.getWeekday();
+    const Days days = (wday <= rhs) ? rhs - wday : Days(7 - static_cast<unsigned short>(wday) + static_cast<unsigned short>(rhs));
+    return(lhs + days);
+   }
+
+
+  /** @relates GregorianDate
+   * Operator minus to move to the previous (pr same) Weekday Date.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDate &lhs, const Weekdays &rhs) -> GregorianDate
+   {
+    const Weekdays wday = lhs.getWeekday();
+    const Days days = (wday >= rhs) ? wday - rhs : Days (7 - static_cast<unsigned short>(rhs) + static_cast<unsigned short>(wday));
+    return(lhs - days);
+   }
+
+
+  /** @relates GregorianDate
+   * Operator minus to subtract a Date value from a Date.
+   *
+   * Calculates the full months between both dates in constant time.
+   * The remaining days are counted from the earlier date moved by these months,
+   * whose day is limited to the last day of its month.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Duration object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDate &lhs, const GregorianDate &rhs) -> Duration
+   {
+    const GregorianDate &date1 = (lhs > rhs) ? rhs : lhs;
+    const GregorianDate &date2 = (lhs > rhs) ? lhs : rhs;
+    const unsigned short day1 = date1.getDay().getDay();
+    const unsigned short day2 = date2.getDay().getDay();
+    const long months = ((date2.getYear().getYear() * 12L) + date2.getMonth().getMonth()) - ((date1.getYear().getYear() * 12L) + date1.getMonth().getMonth()) - ((day2 < day1) ? 1L : 0L);
+    const long anchor = (date1.getYear().getYear() * 12L) + (date1.getMonth().getMonth() - 1L) + months;
+    const long year = anchor / 12L;
+    const unsigned short month = static_cast<unsigned short>((anchor % 12L) + 1L);
+    const unsigned short lastDay = static_cast<unsigned short>(daysOfMonth[month] + (((month == 2) && isGregorianLeapYear(year)) ? 1U : 0U));
+    const unsigned long days = gregorianToJD(date2.getYear().getYear(), date2.getMonth().getMonth(), day2) - gregorianToJD(year, month, (day1 < lastDay) ? day1 : lastDay);
+    return(Duration(Years(static_cast<unsigned long>(months / 12L)), Months(static_cast<unsigned long>(months % 12L)), Days(days)));
+   }
+
+
+  /**
+   * Get easter date for year.
+   *
+   * Anonymous gregorian algorithm (Meeus/Jones/Butcher).
+   *
+   * @param[in] year Gregorian year
+   * @return GregorianDate easter
+   */
+  [[nodiscard]] constexpr static auto getEaster(GregorianYear year) -> GregorianDate
+   {
+    const long a = year.getYear() % 19;
+    const long b = year.getYear() / 100;
+    const long c = year.getYear() % 100;
+    const long d = b / 4;
+    const long e = b % 4;
+    const long f = (b + 8) / 25;
+    const long g = (b - f + 1) / 3;
+    const long h = ((19 * a) + b - d - g + 15) % 30;
+    const long i = c / 4;
+    const long k = c % 4;
+    const long l = (32 + (2 * e) + (2 * i) - h - k) % 7;
+    const long m = (a + (11 * h) + (22 * l)) / 451;
+    const unsigned short dmonth = static_cast<unsigned short>((h + l - (7 * m) + 114) / 31);
+    const unsigned short dday = static_cast<unsigned short>(((h + l - (7 * m) + 114) % 31) + 1);
+    return GregorianDate(year, GregorianMonth(dmonth), GregorianDay(dday));
+   }
+
+
+  /** @relates GregorianDate
+   * Stream operator to write a Date to an output stream.
+   *
+   * @param[in] outs Output stream
+   * @param[in] obj GregorianDate object to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& outs, const GregorianDate& obj) -> std::ostream&
+   {
+    outs << "GregorianDate(" << obj.getYear() << ", " << obj.getMonth() << ", " << obj.getDay() << ")";
+    return outs;
+   }
+
+
+  /**
+   * Factory.
+   *
+   * @param[in] year Year
+   * @param[in] week Week depending on the year
+   * @param[in] weekday Weekday depending on the week
+   * @return GregorianDate
+   * @throws std::out_of_range Date is < 1-1-1 or > 32767-12-31
+   */
+  constexpr auto factory(const GregorianYear year, const GregorianWeek week, const Weekdays weekday) -> GregorianDate
+   {
+    // January 4th is always within the first week
+    const unsigned long jan4 = gregorianToJD(year.getYear(), 1, 4);
+    const unsigned long monday = jan4 - (jdToWeekday(jan4) - 1UL);
+    const unsigned long jd = monday + ((week.getWeek() - 1UL) * 7UL) + (static_cast<unsigned long>(weekday) - 1UL);
+    if (jd < minGregorianJD)
+     {
+      throw std::out_of_range("year will be < 1");
+     }
+    if (jd > maxGregorianJD)
+     {
+      throw std::out_of_range("year will be > 32767");
+     }
+    return(GregorianDate(unchecked, JD(jd)));
+   }
+
+ } // namespace
+
+#endif // DATELIB_GREGORIANDATE_H_
@@ -0,0 +1,316 @@
+/** @file
+ * A Day is a numerical representation of a day within a month without being related to month/year.
+ * So it could have a value between 1 and 31.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_GREGORIANDAY_H_
+#define DATELIB_GREGORIANDAY_H_
+
+
+#include <ostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include "Days.h"
+#include "GregorianMonth.h"
+#include "Expected.h"
+#include "Unchecked.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Value class that represents a day number (1-31) in the gregorian calendar system.
+   */
+  class GregorianDay final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] day Day number (1-31)
+       * @throws std::out_of_range Day is < 1 or > 31
+       */
+      constexpr explicit GregorianDay(const unsigned short day)
+       : day{day}
+       {
+        if (day < 1 || day > 31)
+         {
+          throw std::out_of_range("day is < 1 or > 31");
+         }
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] month Month number (1 - 12)
+       * @param[in] day Day number (1 - max days in month) depending on the month
+       * @throws std::out_of_range Day is < 1 or > max days in month
+       */
+      constexpr explicit GregorianDay(const GregorianMonth month, const unsigned short day)
+       : day{day}
+       {
+        const Days daysInMonth = month.getDaysInMonth();
+        if (day < 1 || day > daysInMonth.getDays())
+         {
+          throw std::out_of_range("day is < 1 or > " + std::to_string(daysInMonth.getDays()));
+         }
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] day Day number (1-31)
+       */
+      constexpr explicit GregorianDay([[maybe_unused]] const Unchecked tag, const unsigned short day) noexcept
+       : day{day}
+       {
+        assert(day >= 1 && day <= 31);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] day Day number (1-31)
+       * @return GregorianDay or ValidationError::DayOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const unsigned short day) noexcept -> Expected<GregorianDay>
+       {
+        if (day < 1 || day > 31)
+         {
+          return(Expected<GregorianDay>(ValidationError::DayOutOfRange));
+         }
+        return(Expected<GregorianDay>(GregorianDay(unchecked, day)));
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] month Month number (1 - 12)
+       * @param[in] day Day number (1 - max days in month) depending on the month
+       * @return GregorianDay or ValidationError::DayOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const GregorianMonth month, const unsigned short day) noexcept -> Expected<GregorianDay>
+       {
+        if (day < 1 || day > month.getDaysInMonth().getDays())
+         {
+          return(Expected<GregorianDay>(ValidationError::DayOutOfRange));
+         }
+        return(Expected<GregorianDay>(GregorianDay(unchecked, day)));
+       }
+
+
+      /**
+       * Copy constructor.
+       *
+       * @param[in] other Another Day object to copy from.
+       */
+      constexpr GregorianDay(const GregorianDay &other) noexcept = default;
+
+      /**
+       * Move constructor.
+       *
+       * @param[in] other Another Day object to move from.
+       */
+      constexpr GregorianDay(GregorianDay&& other) noexcept = default;
+
+      /**
+       * Destructor.
+       */
+      ~GregorianDay() noexcept = default;
+
+      /**
+       * Assignment operator for another Day object.
+       *
+       * @param[in] other Another day object to be assigned to this object.
+       * @return GregorianDay
+       */
+      constexpr auto operator=(const GregorianDay &other) & noexcept -> GregorianDay& = default;
+
+      /**
+       * Move assignment operator for another Day object.
+       *
+       * @param[in] other Another day object to be assigned to this object.
+       * @return GregorianDay&
+       */
+      constexpr auto operator=(GregorianDay&& other) & noexcept -> GregorianDay& = default;
+
+
+      /**
+       * Get day number as primitive data type.
+       *
+       * @return GregorianDay number (1-31)
+       */
+      [[nodiscard]] constexpr auto getDay() const noexcept -> unsigned short
+       {
+        return(this->day);
+       }
+
+    private:
+      unsigned short day;
+
+   };
+
+
+  /** @relates GregorianDay
+   * Operator equal to compare two Day objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are equal in value.
+   */
+  [[nodiscard]] constexpr auto operator==(const GregorianDay &lhs, const GregorianDay &rhs) noexcept -> bool
+   {
+    return(lhs.getDay() == rhs.getDay());
+   }
+
+
+  /** @relates GregorianDay
+   * Operator not equal to compare two Day objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are not equal in value.
+   */
+  [[nodiscard]] constexpr auto operator!=(const GregorianDay &lhs, const GregorianDay &rhs) noexcept -> bool
+   {
+    return(!(lhs == rhs));
+   }
+
+
+  /** @relates GregorianDay
+   * Operator smaller to compare two Day objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<(const GregorianDay &lhs, const GregorianDay &rhs) noexcept -> bool
+   {
+    return(lhs.getDay() < rhs.getDay());
+   }
+
+
+  /** @relates GregorianDay
+   * Operator greater to compare two Day objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>(const GregorianDay &lhs, const GregorianDay &rhs) noexcept -> bool
+   {
+    return(rhs < lhs);
+   }
+
+
+  /** @relates GregorianDay
+   * Operator smaller or equal to compare two Day objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<=(const GregorianDay &lhs, const GregorianDay &rhs) noexcept -> bool
+   {
+    return(!(lhs > rhs));
+   }
+
+
+  /** @relates GregorianDay
+   * Operator greater or equal to compare two Day objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>=(const GregorianDay &lhs, const GregorianDay &rhs) noexcept -> bool
+   {
+    return(!(lhs < rhs));
+   }
+
+
+  /** @relates GregorianDay
+   * Operator plus to add a Days value to a Day (only if the result is smaller than 31).
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDay object
+   * @throws std::out_of_range When Day will become > 31
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianDay &lhs, const Days &rhs) -> GregorianDay
+   {
+    if (rhs.getDays() > 30)
+     {
+      throw std::out_of_range("days is > 30");
+     }
+    if (lhs.getDay() + rhs.getDays() > 31)
+     {
+      throw std::out_of_range("day will be > 31");
+     }
+    return(GregorianDay(lhs.getDay() + static_cast<unsigned short>(rhs.getDays())));
+   }
+
+
+  /** @relates GregorianDay
+   * Operator minus to subtract a Days value from a Day (only if the result is greater than 0).
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianDay object
+   * @throws std::out_of_range When Day will become < 1
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDay &lhs, const Days &rhs) -> GregorianDay
+   {
+    if (rhs.getDays() >= lhs.getDay())
+     {
+      throw std::out_of_range("day will be < 1");
+     }
+    return(GregorianDay(lhs.getDay() - static_cast<unsigned short>(rhs.getDays())));
+   }
+
+
+  /** @relates GregorianDay
+   * Operator minus to get the difference of a Day value to another Day.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Days object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianDay &lhs, const GregorianDay &rhs) noexcept -> Days
+   {
+    if (lhs < rhs)
+     {
+      return(Days(rhs.getDay() - lhs.getDay()));
+     }
+    return(Days(lhs.getDay() - rhs.getDay()));
+   }
+
+
+  /** @relates GregorianDay
+   * Stream operator to write a Day to an output stream.
+   *
+   * @param[in] os Output stream
+   * @param[in] obj GregorianDay object to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& os, const GregorianDay& obj) -> std::ostream&
+   {
+    os << "GregorianDay(" << obj.getDay() << ")";
+    return os;
+   }
+
+ } // namespace
+
+#endif // DATELIB_GREGORIANDAY_H_
@@ -0,0 +1,338 @@
+/** @file
+ * A Week is a numerical representation of a week within a year without being related to the year.
+ * So it could have a value between 1 and 53.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_GREGORIANWEEK_H_
+#define DATELIB_GREGORIANWEEK_H_
+
+
+#include <ostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include "Weeks.h"
+#include "GregorianYear.h"
+#include "Expected.h"
+#include "Unchecked.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Value class that represents a week number (1-53) in the gregorian calendar system.
+   */
+  class GregorianWeek final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] week Day number (1-53)
+       * @throws std::out_of_range Day is < 1 or > 53
+       */
+      constexpr explicit GregorianWeek(const unsigned short week)
+       : week(week), maxWeeks(53UL)
+       {
+        if (week < 1 || week > 53)
+         {
+          throw std::out_of_range("week is < 1 or > 53");
+         }
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] week Day number (1 - max weeks in year) depending on the year
+       * @param[in] year Year
+       * @throws std::out_of_range Week is < 1 or > max weeks in year
+       */
+      constexpr explicit GregorianWeek(const unsigned short week, const GregorianYear year)
+       : week(week), maxWeeks{year.getWeeksInYear().getWeeks()}
+       {
+        if (week < 1 || week > this->maxWeeks)
+         {
+          throw std::out_of_range("week is < 1 or > " + std::to_string(this->maxWeeks));
+         }
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] week Week number (1-53)
+       */
+      constexpr explicit GregorianWeek([[maybe_unused]] const Unchecked tag, const unsigned short week) noexcept
+       : week(week), maxWeeks(53UL)
+       {
+        assert(week >= 1 && week <= 53);
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] week Week number (1 - max weeks in year) depending on the year
+       * @param[in] year Year
+       */
+      constexpr explicit GregorianWeek([[maybe_unused]] const Unchecked tag, const unsigned short week, const GregorianYear year) noexcept
+       : week(week), maxWeeks{year.getWeeksInYear().getWeeks()}
+       {
+        assert(week >= 1 && week <= this->maxWeeks);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] week Week number (1-53)
+       * @return GregorianWeek or ValidationError::WeekOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const unsigned short week) noexcept -> Expected<GregorianWeek>
+       {
+        if (week < 1 || week > 53)
+         {
+          return(Expected<GregorianWeek>(ValidationError::WeekOutOfRange));
+         }
+        return(Expected<GregorianWeek>(GregorianWeek(unchecked, week)));
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] week Week number (1 - max weeks in year) depending on the year
+       * @param[in] year Year
+       * @return GregorianWeek or ValidationError::WeekOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const unsigned short week, const GregorianYear year) noexcept -> Expected<GregorianWeek>
+       {
+        if (week < 1 || week > year.getWeeksInYear().getWeeks())
+         {
+          return(Expected<GregorianWeek>(ValidationError::WeekOutOfRange));
+         }
+        return(Expected<GregorianWeek>(GregorianWeek(unchecked, week, year)));
+       }
+
+
+      /**
+       * Copy constructor.
+       *
+       * @param[in] other Another Week object to copy from.
+       */
+      constexpr GregorianWeek(const GregorianWeek &other) noexcept = default;
+
+      /**
+       * Move constructor.
+       *
+       * @param[in] other Another Week object to move from.
+       */
+      constexpr GregorianWeek(GregorianWeek&& other) noexcept = default;
+
+      /**
+       * Destructor.
+       */
+      ~GregorianWeek() noexcept = default;
+
+      /**
+       * Assignment operator for another Week object.
+       *
+       * @param[in] other Another week object to be assigned to this object.
+       */
+      constexpr auto operator=(const GregorianWeek &other) & noexcept -> GregorianWeek& = default;
+
+      /**
+       * Move assignment operator for another Week object.
+       *
+       * @param[in] other Another week object to be assigned to this object.
+       * @return GregorianWeek&
+       */
+      constexpr auto operator=(GregorianWeek&& other) & noexcept -> GregorianWeek& = default;
+
+
+      /**
+       * Get week number as primitive data type.
+       *
+       * @return Week number (1-53)
+       */
+      [[nodiscard]] constexpr auto getWeek() const noexcept -> unsigned short
+       {
+        return(this->week);
+       }
+
+
+      /**
+       * Get maximum weeks as primitive data type.
+       *
+       * @return Maximum Weeks (52/53)
+       */
+      [[nodiscard]] constexpr auto getMaxWeeks() const noexcept -> unsigned long
+       {
+        return(this->maxWeeks);
+       }
+
+    private:
+      unsigned short week;
+      unsigned long maxWeeks;
+
+   };
+
+
+  /** @relates GregorianWeek
+   * Operator equal to compare two Week objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are equal in value.
+   */
+  [[nodiscard]] constexpr auto operator==(const GregorianWeek &lhs, const GregorianWeek &rhs) noexcept -> bool
+   {
+    return(lhs.getWeek() == rhs.getWeek());
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator not equal to compare two Week objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are not equal in value.
+   */
+  [[nodiscard]] constexpr auto operator!=(const GregorianWeek &lhs, const GregorianWeek &rhs) noexcept -> bool
+   {
+    return(!(lhs == rhs));
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator smaller to compare two Week objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<(const GregorianWeek &lhs, const GregorianWeek &rhs) noexcept -> bool
+   {
+    return(lhs.getWeek() < rhs.getWeek());
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator greater to compare two Week objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>(const GregorianWeek &lhs, const GregorianWeek &rhs) noexcept -> bool
+   {
+    return(rhs < lhs);
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator smaller or equal to compare two Week objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<=(const GregorianWeek &lhs, const GregorianWeek &rhs) noexcept -> bool
+   {
+    return(!(lhs > rhs));
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator greater or equal to compare two Week objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>=(const GregorianWeek &lhs, const GregorianWeek &rhs) noexcept -> bool
+   {
+    return(!(lhs < rhs));
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator plus to add a Weeks value to a Week (only if the result is smaller than 53).
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Week object
+   * @throws std::out_of_range When Week will become > 53
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianWeek &lhs, const Weeks &rhs) -> GregorianWeek
+   {
+    if (lhs.getWeek() + rhs.getWeeks() > lhs.getMaxWeeks())
+     {
+      throw std::out_of_range("week will be > " + std::to_string(lhs.getMaxWeeks()));
+     }
+    return(GregorianWeek(lhs.getWeek() + static_cast<unsigned short>(rhs.getWeeks())));
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator minus to subtract a Weeks value from a Week (only if the result is greater than 0).
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Week object
+   * @throws std::out_of_range When Week will become < 1
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianWeek &lhs, const Weeks &rhs) -> GregorianWeek
+   {
+    if (rhs.getWeeks() >= lhs.getWeek())
+     {
+      throw std::out_of_range("week will be < 1");
+     }
+    return(GregorianWeek(lhs.getWeek() - static_cast<unsigned short>(rhs.getWeeks())));
+   }
+
+
+  /** @relates GregorianWeek
+   * Operator minus to get the difference of a Week value to another Week.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Weeks object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianWeek &lhs, const GregorianWeek &rhs) noexcept -> Weeks
+   {
+    if (lhs < rhs)
+     {
+      return(Weeks(rhs.getWeek() - lhs.getWeek()));
+     }
+    return(Weeks(lhs.getWeek() - rhs.getWeek()));
+   }
+
+
+  /** @relates GregorianWeek
+   * Stream operator to write a GregorianWeek to an output stream.
+   *
+   * @param[in] os Output stream
+   * @param[in] obj GregorianWeek object to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& os, const GregorianWeek& obj) -> std::ostream&
+   {
+    os << "GregorianWeek(" << obj.getWeek() << ")";
+    return os;
+   }
+
+ } // namespace
+
+#endif // DATELIB_GREGORIANWEEK_H_
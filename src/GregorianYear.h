@@ -0,0 +1,322 @@
+/** @file
+ * A Year is a numerical representation of a year.
+ * So it could have a value between 1 and 32767.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_GREGORIANYEAR_H_
+#define DATELIB_GREGORIANYEAR_H_
+
+
+#include <ostream>
+#include <cassert>
+#include <stdexcept>
+#include <climits>
+#include "Days.h"
+#include "Years.h"
+#include "Weeks.h"
+#include "Weekdays.h"
+#include "DayNumber.h"
+#include "Expected.h"
+#include "Unchecked.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Value class that represents a year number (1-32767) in the gregorian calendar system.
+   */
+  class GregorianYear final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] year Year number (1-32767)
+       * @throws std::out_of_range Year is < 1 or > 32767
+       */
+      constexpr explicit GregorianYear(const long year)
+       : year(year)
+       {
+        if (year < 1 || year > 32767)
+         {
+          throw std::out_of_range("year is < 1 or > 32767");
+         }
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] year Year number (1-32767)
+       */
+      constexpr explicit GregorianYear([[maybe_unused]] const Unchecked tag, const long year) noexcept
+       : year(year)
+       {
+        assert(year >= 1 && year <= 32767);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] year Year number (1-32767)
+       * @return GregorianYear or ValidationError::YearOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const long year) noexcept -> Expected<GregorianYear>
+       {
+        if (year < 1 || year > 32767)
+         {
+          return(Expected<GregorianYear>(ValidationError::YearOutOfRange));
+         }
+        return(Expected<GregorianYear>(GregorianYear(unchecked, year)));
+       }
+
+
+       /**
+        * Copy constructor.
+        *
+        * @param[in] other Another Year object to copy from.
+        */
+      constexpr GregorianYear(const GregorianYear &other) noexcept = default;
+
+      /**
+       * Move constructor.
+       *
+       * @param[in] other Another Year object to move from.
+       */
+      constexpr GregorianYear(GregorianYear&& other) noexcept = default;
+
+      /**
+       * Destructor.
+       */
+      ~GregorianYear() noexcept = default;
+
+      /**
+       * Assignment operator for another Year object.
+       *
+       * @param[in] other Another year object to be assigned to this object.
+       * @return GregorianYear
+       */
+      constexpr auto operator=(const GregorianYear &other) & noexcept -> GregorianYear& = default;
+
+      /**
+       * Move assignment operator for another Year object.
+       *
+       * @param[in] other Another year object to be assigned to this object.
+       * @return GregorianYear&
+       */
+      constexpr auto operator=(GregorianYear&& other) & noexcept -> GregorianYear& = default;
+
+
+      /**
+       * Get year number as primitive data type.
+       *
+       * @return GregorianYear number (1-32767)
+       */
+      [[nodiscard]] constexpr auto getYear() const noexcept -> long
+       {
+        return(this->year);
+       }
+
+
+      /**
+       * Is leap year.
+       *
+       * @return true: leap year, false: otherwise
+       */
+      [[nodiscard]] constexpr auto isLeapYear() const noexcept -> bool
+       {
+        return(isGregorianLeapYear(this->year));
+       }
+
+
+      /**
+       * Number of days in year.
+       *
+       * @return Number of days in year (365|366)
+       */
+      [[nodiscard]] constexpr auto getDaysInYear() const noexcept -> Days
+       {
+        return Days(isLeapYear() ? 366 : 365);
+       }
+
+
+      /**
+       * Number of weeks in year.
+       *
+       * @return Number of weeks in year (52|53)
+       */
+      [[nodiscard]] constexpr auto getWeeksInYear() const noexcept -> Weeks
+       {
+        return(Weeks(gregorianWeeksInYear(this->year)));
+       }
+
+
+    private:
+      long year;
+
+   };
+
+
+  /** @relates GregorianYear
+   * Operator equal to compare two Year objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are equal in value.
+   */
+  [[nodiscard]] constexpr auto operator==(const GregorianYear &lhs, const GregorianYear &rhs) noexcept -> bool
+   {
+    return(lhs.getYear() == rhs.getYear());
+   }
+
+
+  /** @relates GregorianYear
+   * Operator not equal to compare two Year objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are not equal in value.
+   */
+  [[nodiscard]] constexpr auto operator!=(const GregorianYear &lhs, const GregorianYear &rhs) noexcept -> bool
+   {
+    return(!(lhs == rhs));
+   }
+
+
+  /** @relates GregorianYear
+   * Operator smaller to compare two Year objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<(const GregorianYear &lhs, const GregorianYear &rhs) noexcept -> bool
+   {
+    return(lhs.getYear() < rhs.getYear());
+   }
+
+
+  /** @relates GregorianYear
+   * Operator greater to compare two Year objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>(const GregorianYear &lhs, const GregorianYear &rhs) noexcept -> bool
+   {
+    return(rhs < lhs);
+   }
+
+
+  /** @relates GregorianYear
+   * Operator smaller or equal to compare two Year objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<=(const GregorianYear &lhs, const GregorianYear &rhs) noexcept -> bool
+   {
+    return(!(lhs > rhs));
+   }
+
+
+  /** @relates GregorianYear
+   * Operator greater or equal to compare two Year objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>=(const GregorianYear &lhs, const GregorianYear &rhs) noexcept -> bool
+   {
+    return(!(lhs < rhs));
+   }
+
+
+  /** @relates GregorianYear
+   * Operator plus to add a Years value to a Year (only if the result is smaller than 32767).
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianYear object
+   * @throws std::out_of_range When Year will become > 32767
+   */
+  [[nodiscard]] constexpr auto operator+(const GregorianYear &lhs, const Years &rhs) -> GregorianYear
+   {
+    if (rhs.getYears() > static_cast<unsigned long>(LONG_MAX - lhs.getYear()))
+     {
+      throw std::out_of_range("year will be > LONG_MAX");
+     }
+    if (rhs.getYears() > static_cast<unsigned long>(32767 - lhs.getYear()))
+     {
+      throw std::out_of_range("year will be > 32767");
+     }
+    return(GregorianYear(lhs.getYear() + static_cast<long>(rhs.getYears())));
+   }
+
+
+  /** @relates GregorianYear
+   * Operator minus to subtract a Years value from a Year (only if the result is greater than 1).
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New GregorianYear object
+   * @throws std::out_of_range When Year will become < 1
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianYear &lhs, const Years &rhs) -> GregorianYear
+   {
+    if (rhs.getYears() > static_cast<unsigned long>(lhs.getYear()))
+     {
+      throw std::out_of_range("year will be < 0");
+     }
+    if (rhs.getYears() == static_cast<unsigned long>(lhs.getYear()))
+     {
+      throw std::out_of_range("year will be < 1");
+     }
+    return(GregorianYear(lhs.getYear() - static_cast<long>(rhs.getYears())));
+   }
+
+
+  /** @relates GregorianYear
+   * Operator minus to get the difference of a Year to another Year.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Years object
+   */
+  [[nodiscard]] constexpr auto operator-(const GregorianYear &lhs, const GregorianYear &rhs) noexcept -> Years
+   {
+    if (lhs < rhs)
+     {
+      return(Years(rhs.getYear() - lhs.getYear()));
+     }
+    return(Years(lhs.getYear() - rhs.getYear()));
+   }
+
+
+  /** @relates GregorianYear
+   * Stream operator to write a Year to an output stream.
+   *
+   * @param[in] os Output stream
+   * @param[in] obj GregorianYear object to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& os, const GregorianYear& obj) -> std::ostream&
+   {
+    os << "GregorianYear(" << obj.getYear() << ")";
+    return os;
+   }
+
+ } // namespace
+
+#endif // DATELIB_GREGORIANYEAR_H_
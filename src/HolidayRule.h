@@ -0,0 +1,198 @@
+/** @file
+ * Rule for a holiday in the julian calendar system: a fixed date, the n-th weekday of a month or a day relative to easter.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_HOLIDAYRULE_H_
+#define DATELIB_HOLIDAYRULE_H_
+
+
+#include <stdexcept>
+#include <string>
+#include "JulianMonth.h"
+#include "JulianDay.h"
+#include "Weekdays.h"
+#include "DayNumber.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Kind of a holiday rule.
+   */
+  enum class HolidayKind : unsigned short
+   {
+    /**
+     * Same month and day every year.
+     */
+    Fixed = 0,
+
+    /**
+     * N-th or n-th last weekday of a month.
+     */
+    NthWeekday = 1,
+
+    /**
+     * Number of days before or after easter sunday.
+     */
+    Easter = 2
+   };
+
+
+  /**
+   * Value class that represents a holiday rule.
+   */
+  class HolidayRule final
+   {
+    public:
+      /**
+       * Factory for a holiday on the same month and day every year.
+       *
+       * A february 29 holiday only occurs in leap years.
+       *
+       * @param[in] month Month
+       * @param[in] day Day
+       * @return HolidayRule
+       * @throws std::out_of_range When day is > days of the month (29 for february)
+       */
+      [[nodiscard]] static constexpr auto fixed(const JulianMonth month, const JulianDay day) -> HolidayRule
+       {
+        const unsigned long maxDay = daysOfMonth[month.getMonth()] + ((month.getMonth() == 2) ? 1U : 0U);
+        if (day.getDay() > maxDay)
+         {
+          throw std::out_of_range("day is > " + std::to_string(maxDay));
+         }
+        return(HolidayRule(HolidayKind::Fixed, month.getMonth(), day.getDay(), 0));
+       }
+
+
+      /**
+       * Factory for a holiday on the n-th weekday of a month.
+       *
+       * A fifth weekday only occurs in some years.
+       *
+       * @param[in] month Month
+       * @param[in] weekday Weekday
+       * @param[in] ordinal n for the n-th and -n for the n-th last weekday within the month (1-5)
+       * @return HolidayRule
+       * @throws std::out_of_range When ordinal is 0 or < -5 or > 5
+       */
+      [[nodiscard]] static constexpr auto nthWeekday(const JulianMonth month, const Weekdays weekday, const long ordinal) -> HolidayRule
+       {
+        if ((ordinal == 0) || (ordinal < -5) || (ordinal > 5))
+         {
+          throw std::out_of_range("ordinal is 0 or < -5 or > 5");
+         }
+        return(HolidayRule(HolidayKind::NthWeekday, month.getMonth(), static_cast<unsigned short>(weekday), ordinal));
+       }
+
+
+      /**
+       * Factory for a holiday relative to easter sunday.
+       *
+       * Days that fall into the previous or next year do not occur.
+       *
+       * @param[in] offset Days after (or before for negative values) easter sunday
+       * @return HolidayRule
+       * @throws std::out_of_range When offset is < -366 or > 366
+       */
+      [[nodiscard]] static constexpr auto easter(const long offset) -> HolidayRule
+       {
+        if ((offset < -366) || (offset > 366))
+         {
+          throw std::out_of_range("offset is < -366 or > 366");
+         }
+        return(HolidayRule(HolidayKind::Easter, 0, 0, offset));
+       }
+
+
+      /**
+       * Get kind.
+       *
+       * @return HolidayKind
+       */
+      [[nodiscard]] constexpr auto getKind() const noexcept -> HolidayKind
+       {
+        return(this->kind);
+       }
+
+
+      /**
+       * Get day within a year.
+       *
+       * @param[in] year Year (8-32767)
+       * @return Day within year (1-366) or 0 when the holiday does not occur in this year
+       */
+      [[nodiscard]] constexpr auto getDayWithinYear(const long year) const noexcept -> unsigned short
+       {
+        switch (this->kind)
+         {
+          case HolidayKind::Fixed:
+            if ((this->month == 2) && (this->day == 29) && ((year % 4) != 0))
+             {
+              return(0);
+             }
+            return(julianDayWithinYear(year, this->month, this->day));
+          case HolidayKind::NthWeekday:
+           {
+            const unsigned long daysInMonth = daysOfMonth[this->month] + (((this->month == 2) && ((year % 4) == 0)) ? 1U : 0U);
+            const unsigned short first = julianDayWithinYear(year, this->month, 1);
+            long dayOfMonth = 0;
+            if (this->offset > 0)
+             {
+              const unsigned long firstWeekday = ((julianFirstWeekday(year) - 1UL + first - 1UL) % 7UL) + 1UL;
+              dayOfMonth = static_cast<long>(1UL + ((this->day + 7UL - firstWeekday) % 7UL)) + (7 * (this->offset - 1));
+             }
+            else
+             {
+              const unsigned long lastWeekday = ((julianFirstWeekday(year) - 1UL + first - 1UL + daysInMonth - 1UL) % 7UL) + 1UL;
+              dayOfMonth = static_cast<long>(daysInMonth - ((lastWeekday + 7UL - this->day) % 7UL)) + (7 * (this->offset + 1));
+             }
+            if ((dayOfMonth < 1) || (dayOfMonth > static_cast<long>(daysInMonth)))
+             {
+              return(0);
+             }
+            return(static_cast<unsigned short>(first + dayOfMonth - 1));
+           }
+          case HolidayKind::Easter:
+          default:
+           {
+            const YearMonthDay sunday = julianEaster(year);
+            const long dayWithinYear = julianDayWithinYear(year, sunday.month, sunday.day) + this->offset;
+            if ((dayWithinYear < 1) || (dayWithinYear > (((year % 4) == 0) ? 366 : 365)))
+             {
+              return(0);
+             }
+            return(static_cast<unsigned short>(dayWithinYear));
+           }
+         }
+       }
+
+    private:
+      HolidayKind kind;
+      unsigned short month;
+      unsigned short day;
+      long offset;
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] kind Kind
+       * @param[in] month Month (1-12) or 0 for easter
+       * @param[in] day Day of the month for fixed holidays or weekday (1-7) for nth weekday holidays
+       * @param[in] offset Ordinal for nth weekday or day offset for easter holidays
+       */
+      constexpr HolidayRule(const HolidayKind kind, const unsigned short month, const unsigned short day, const long offset) noexcept
+       : kind(kind), month(month), day(day), offset(offset)
+       {
+       }
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_HOLIDAYRULE_H_
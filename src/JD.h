@@ -11,6 +11,8 @@
 #include <stdexcept>
 #include <climits>
 #include "Days.h"
+#include "Weekdays.h"
+#include "DayNumber.h"
 
 
 /** @namespace de::powerstat::datelib
@@ -63,7 +65,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another JD object to be assigned to this object.
        */
-      auto operator=(const JD &other) & noexcept -> JD& = delete;
+      constexpr auto operator=(const JD &other) & noexcept -> JD& = default;
 
       /**
        * Move assignment operator for another JD object.
@@ -71,7 +73,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another JD object to be assigned to this object.
        * @return JD&
        */
-      auto operator=(JD&& other) & noexcept -> JD& = delete;
+      constexpr auto operator=(JD&& other) & noexcept -> JD& = default;
 
 
       /**
@@ -84,8 +86,21 @@ namespace de::powerstat::datelib
         return(this->jd);
        }
 
+
+      /**
+       * Get ISO weekday of this day.
+       *
+       * Only a modulo 7, because the JD numbers count the days without gaps.
+       *
+       * @return Weekday
+       */
+      [[nodiscard]] constexpr auto getWeekday() const noexcept -> Weekdays
+       {
+        return(Weekdays(jdToWeekday(this->jd)));
+       }
+
     private:
-      const unsigned long jd;
+      unsigned long jd;
 
    };
 
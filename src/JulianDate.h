@@ -9,6 +9,8 @@
 
 
 #include <ostream>
+#include <cassert>
+#include <cstddef>
 #include <stdexcept>
 #include <string>
 #include "Weekdays.h"
@@ -18,10 +20,13 @@
 #include "Weeks.h"
 #include "Duration.h"
 #include "JD.h"
+#include "DayNumber.h"
 #include "JulianDay.h"
 #include "JulianMonth.h"
 #include "JulianYear.h"
 #include "JulianWeek.h"
+#include "Expected.h"
+#include "Unchecked.h"
 
 #include <iostream>
 
@@ -63,13 +68,97 @@ namespace de::powerstat::datelib
        * @param[in] jd JD
        */
       constexpr explicit JulianDate(const JD jd)
-       : year([](const JD& jd) constexpr -> const JulianYear {const unsigned long a = jd.getJD() + 1524; const unsigned short b = static_cast<unsigned short>((a - 122.1) / 365.25); const unsigned short c = static_cast<unsigned short>(a - static_cast<unsigned long>(365.25 * b)); const unsigned short d = static_cast<unsigned short>(c / 30.6001); return JulianYear(static_cast<long>(static_cast<unsigned short>(d < 14 ? d - 1 : d - 13) > 2 ? b - 4716 : b - 4715));}(jd)),
-         month([](const JD& jd) constexpr -> const JulianMonth {const unsigned long a = jd.getJD() + 1524; const unsigned short b = static_cast<unsigned short>((a - 122.1) / 365.25); const unsigned short c = static_cast<unsigned short>(a - static_cast<unsigned long>(365.25 * b)); const unsigned short d = static_cast<unsigned short>(c / 30.6001); return JulianMonth(static_cast<unsigned short>(d < 14 ? d - 1 : d - 13));}(jd)),
-         day([](const JD& jd) constexpr -> const JulianDay {const unsigned long a = jd.getJD() + 1524; const unsigned short b = static_cast<unsigned short>((a - 122.1) / 365.25); const unsigned short c = static_cast<unsigned short>(a - static_cast<unsigned long>(365.25 * b)); const unsigned short d = static_cast<unsigned short>(c / 30.6001); return JulianDay(static_cast<unsigned short>(c - static_cast<unsigned short>(30.6001 * d)));}(jd))
+       : JulianDate(jdToJulian(jd.getJD()))
        {
        }
 
 
+      /**
+       * Constructor.
+       *
+       * @param[in] year Year
+       * @param[in] dayWithinYear Day within year (1-365 or 1-366 within leap years)
+       * @throws std::out_of_range When dayWithinYear is < 1 or > days within year
+       */
+      constexpr explicit JulianDate(const JulianYear year, const Days dayWithinYear)
+       : JulianDate([](const JulianYear year, const Days dayWithinYear) constexpr -> YearMonthDay {const unsigned long daysInYear = year.isLeapYear() ? 366 : 365; if ((dayWithinYear.getDays() < 1) || (dayWithinYear.getDays() > daysInYear)) {throw std::out_of_range("day within year is < 1 or > " + std::to_string(daysInYear));} return julianFromDayWithinYear(year.getYear(), static_cast<unsigned short>(dayWithinYear.getDays()));}(year, dayWithinYear))
+       {
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] year Year number (8-32767)
+       * @param[in] month Month number (1-12)
+       * @param[in] day Day number (1 - max days in month) depending on year and month
+       */
+      constexpr explicit JulianDate([[maybe_unused]] const Unchecked tag, const long year, const unsigned short month, const unsigned short day) noexcept
+       : year(unchecked, year), month(unchecked, this->year, month), day(unchecked, day)
+       {
+        assert(day <= daysOfMonth[month] + (((month == 2) && ((year % 4) == 0)) ? 1U : 0U));
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] jd JD (8-01-01 - 32767-12-31)
+       */
+      constexpr explicit JulianDate(const Unchecked tag, const JD jd) noexcept
+       : JulianDate(tag, jdToJulian(jd.getJD()))
+       {
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] year Year number (8-32767)
+       * @param[in] month Month number (1-12)
+       * @param[in] day Day number (1 - max days in month) depending on year and month
+       * @return JulianDate or ValidationError::YearOutOfRange, ValidationError::MonthOutOfRange, ValidationError::DayOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const long year, const unsigned short month, const unsigned short day) noexcept -> Expected<JulianDate>
+       {
+        if (year < 8 || year > 32767)
+         {
+          return(Expected<JulianDate>(ValidationError::YearOutOfRange));
+         }
+        if (month < 1 || month > 12)
+         {
+          return(Expected<JulianDate>(ValidationError::MonthOutOfRange));
+         }
+        if (day < 1 || day > daysOfMonth[month] + (((month == 2) && ((year % 4) == 0)) ? 1U : 0U))
+         {
+          return(Expected<JulianDate>(ValidationError::DayOutOfRange));
+         }
+        return(Expected<JulianDate>(JulianDate(unchecked, year, month, day)));
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] jd JD
+       * @return JulianDate or ValidationError::JDOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const JD jd) noexcept -> Expected<JulianDate>
+       {
+        if (jd.getJD() < minJulianJD || jd.getJD() > maxJulianJD)
+         {
+          return(Expected<JulianDate>(ValidationError::JDOutOfRange));
+         }
+        return(Expected<JulianDate>(JulianDate(unchecked, jd)));
+       }
+
+
       /**
        * Copy constructor.
        *
@@ -94,7 +183,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another date object to be assigned to this object.
        */
-      auto operator=(const JulianDate &other) & noexcept -> JulianDate& = delete;
+      constexpr auto operator=(const JulianDate &other) & noexcept -> JulianDate& = default;
 
       /**
        * Move assignment operator for another Date object.
@@ -102,7 +191,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another date object to be assigned to this object.
        * @return JulianDate&
        */
-      auto operator=(JulianDate&& other) & noexcept -> JulianDate& = delete;
+      constexpr auto operator=(JulianDate&& other) & noexcept -> JulianDate& = default;
 
 
       /**
@@ -145,38 +234,7 @@ namespace de::powerstat::datelib
        */
       [[nodiscard]] constexpr auto getWeekday() const noexcept -> Weekdays
        {
-        const unsigned short day = this->day.getDay();
-        unsigned short month = this->month.getMonth();
-        long year = this->year.getYear();
-
-        // January and february dates must be 13 and 14 of the year before!
-        switch (month)
-         {
-          case 1 :
-          case 2 :
-            month += 12;
-            --year;
-            [[fallthrough]];
-          default:
-            ;
-         }
-        const unsigned short decade = static_cast<unsigned short>(year - ((year / 100) * 100));
-        // Formula from Ch. Zeller in 1877
-        unsigned short wday = static_cast<unsigned short>((day + (((month + 1) * 26) / 10) + decade + (decade / 4) + 5 - static_cast<unsigned short>(year / 100)) % 7);
-        // Convert (1-su 2-mo 3-tu 4-we 5-th 6-fr 7/0-sa) to iso days
-        if (wday == 0)
-         {
-          wday = 6;
-         }
-        else
-         {
-          --wday;
-          if (wday == 0)
-           {
-            wday = 7;
-           }
-         }
-        return(Weekdays(wday));
+        return(getJD().getWeekday());
        }
 
 
@@ -185,15 +243,9 @@ namespace de::powerstat::datelib
        *
        * @return Days (1-366)
        */
-      [[nodiscard]] constexpr auto getDayWithinYear() const -> Days
+      [[nodiscard]] constexpr auto getDayWithinYear() const noexcept -> Days
        {
-        unsigned long days = 0;
-        for (unsigned short month = 1; month < this->month.getMonth(); ++month)
-         {
-          days += JulianMonth(this->year, month).getDaysInMonth().getDays();
-         }
-        days += this->day.getDay();
-        return Days(days);
+        return(Days(julianDayWithinYear(this->year.getYear(), this->month.getMonth(), this->day.getDay())));
        }
 
 
@@ -204,30 +256,16 @@ namespace de::powerstat::datelib
        */
       [[nodiscard]] constexpr auto getWeek() const -> JulianWeek
        {
-        const JulianDate firstday = JulianDate(this->year, JulianMonth(1), JulianDay(1));
-        Weekdays firstweekday = firstday.getWeekday();
-        unsigned long week = (getDayWithinYear().getDays() - 1 + static_cast<unsigned long>(firstweekday) - 1) / 7;
-        if (firstweekday > Weekdays::Thursday)
+        const long week = static_cast<long>((getDayWithinYear().getDays() + julianFirstWeekShift(this->year.getYear()) + 3UL) / 7UL);
+        if (week < 1)
          {
-          if (week == 0)
-           {
-            week = (this->year.getYear() == 8) ? 52 : JulianDate(JulianYear(this->year.getYear() - 1), JulianMonth(12), JulianDay(31)).getWeek().getWeek();
-           }
-          else if ((firstweekday == Weekdays::Sunday) && this->year.isLeapYear() && (this->month.getMonth() == 12) && (this->day.getDay() == 31))
-           {
-            week = 1;
-           }
-          return JulianWeek(week);
+          return(JulianWeek((this->year.getYear() == 8) ? 52 : julianWeeksInYear(this->year.getYear() - 1)));
          }
-        else if ([](long year1, unsigned short month1, unsigned day1, long year2, unsigned short month2, unsigned day2) constexpr -> short {short result = (year1 < year2) ? -1 : ((year1 > year2) ? 1 : 0); if (result != 0) {return result;} result = (month1 < month2) ? -1 : ((month1 > month2) ? 1 : 0); if (result != 0) {return result;} return (day1 < day2) ? -1 : ((day1 > day2) ? 1 : 0);}(this->year.getYear(), this->month.getMonth(), this->day.getDay(), this->year.getYear(), 12, 29) != -1)
+        if (week > julianWeeksInYear(this->year.getYear()))
          {
-          firstweekday = JulianDate(this->year, JulianMonth(12), this->day).getWeekday();
-          if (static_cast<unsigned short>(firstweekday) <= (this->day.getDay() - 28))
-           {
-            week = 0;
-           }
+          return(JulianWeek(1));
          }
-        return(JulianWeek(week + 1));
+        return(JulianWeek(static_cast<unsigned short>(week)));
        }
 
 
@@ -236,15 +274,39 @@ namespace de::powerstat::datelib
        *
        * @return JD
        */
-      [[nodiscard]] constexpr auto getJD() const -> JD
+      [[nodiscard]] constexpr auto getJD() const noexcept -> JD
        {
-        return(this->year.getScaligerYear().getJD() + (getDayWithinYear() - Days(1)));
+        return(JD(julianFirstJD(this->year.getYear()) + getDayWithinYear().getDays() - 1UL));
        }
 
     private:
-      const JulianYear year;
-      const JulianMonth month;
-      const JulianDay day;
+      /**
+       * Constructor.
+       *
+       * @param[in] ymd Decoded year, month and day
+       * @throws std::out_of_range Date is < 8-1-1 or > 32767-12-31
+       */
+      constexpr explicit JulianDate(const YearMonthDay ymd)
+       : year(ymd.year), month(year, ymd.month), day(ymd.day)
+       {
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] ymd Decoded year, month and day
+       */
+      constexpr explicit JulianDate(const Unchecked tag, const YearMonthDay ymd) noexcept
+       : JulianDate(tag, ymd.year, ymd.month, ymd.day)
+       {
+       }
+
+
+      JulianYear year;
+      JulianMonth month;
+      JulianDay day;
 
    };
 
@@ -413,42 +475,15 @@ namespace de::powerstat::datelib
    * @param[in] rhs Right hand side object
    * @return New Days object
    */
-  [[nodiscard]] constexpr auto dayDiff(const JulianDate &lhs, const JulianDate &rhs) -> Days
+  [[nodiscard]] constexpr auto dayDiff(const JulianDate &lhs, const JulianDate &rhs) noexcept -> Days
    {
-    long year1 = lhs.getYear().getYear();
-    long year2 = rhs.getYear().getYear();
-    unsigned short month1 = lhs.getMonth().getMonth();
-    unsigned short month2 = rhs.getMonth().getMonth();
-    const unsigned short day1 = lhs.getDay().getDay();
-    const unsigned short day2 = rhs.getDay().getDay();
-    long t1 = day1;
-    long t2 = day2;
-
-    while (month1 > 1)
-     {// calc days left by the gone month of the year1
-      --month1;
-      t1 += JulianMonth(lhs.getYear(), month1).getDaysInMonth().getDays();
-     }
-    while (month2 > 1)
-     {// calc days left by the gone month of the year2
-      --month2;
-      t2 += JulianMonth(rhs.getYear(), month2).getDaysInMonth().getDays();
-     }
-    while (year1 > year2)
-     {// calc days of diff years
-      --year1;
-      t1 += JulianYear(year1).getDaysInYear().getDays();
-     }
-    while (year1 < year2)
-     {// calc days of diff years
-      --year2;
-      t2 += JulianYear(year2).getDaysInYear().getDays();
-     }
-    if (t1 > t2)
+    const unsigned long jd1 = julianToJD(lhs.getYear().getYear(), lhs.getMonth().getMonth(), lhs.getDay().getDay());
+    const unsigned long jd2 = julianToJD(rhs.getYear().getYear(), rhs.getMonth().getMonth(), rhs.getDay().getDay());
+    if (jd1 > jd2)
      {
-      return(Days(t1 - t2));
+      return(Days(jd1 - jd2));
      }
-    return(Days(t2 - t1));
+    return(Days(jd2 - jd1));
    }
 
 
@@ -458,35 +493,16 @@ namespace de::powerstat::datelib
    * @param[in] lhs Left hand side object
    * @param[in] rhs Right hand side object
    * @return New JulianDate object
+   * @throws std::out_of_range When Date will become > 32767-12-31
    */
   [[nodiscard]] constexpr auto operator+(const JulianDate &lhs, const Days &rhs) -> JulianDate
    {
-    long dyear = lhs.getYear().getYear();
-    unsigned short dmonth = lhs.getMonth().getMonth();
-    unsigned short dday = lhs.getDay().getDay();
-    unsigned long days = rhs.getDays();
-    unsigned long ddays = dayDiff(lhs, JulianDate(JulianYear(lhs.getYear()), JulianMonth(1), JulianDay(1)) + Years(1)).getDays();
-    while (days >= ddays) // years
-     {
-      dday = 1;
-      dmonth = 1;
-      ++dyear;
-      days -= ddays;
-      ddays = dayDiff(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)), JulianDate(JulianYear(dyear), JulianMonth(1), JulianDay(1)) + Years(1)).getDays();
-     }
-    ddays = dayDiff(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)), JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(1)) + Months(1)).getDays();
-    while (days >= ddays) // months
+    const unsigned long jd = julianToJD(lhs.getYear().getYear(), lhs.getMonth().getMonth(), lhs.getDay().getDay());
+    if (rhs.getDays() > maxJulianJD - jd)
      {
-      dday = 1;
-      ++dmonth;
-      days -= ddays;
-      ddays = dayDiff(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)), JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(1)) + Months(1)).getDays();
+      throw std::out_of_range("year will be > 32767");
      }
-    if (days > 0) // days
-     {
-      dday += static_cast<unsigned short>(days);
-     }
-    return(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)));
+    return(JulianDate(unchecked, JD(jd + rhs.getDays())));
    }
 
 
@@ -496,35 +512,16 @@ namespace de::powerstat::datelib
    * @param[in] lhs Left hand side object
    * @param[in] rhs Right hand side object
    * @return New JulianDate object
+   * @throws std::out_of_range When Date will become < 8-01-01
    */
   [[nodiscard]] constexpr auto operator-(const JulianDate &lhs, const Days &rhs) -> JulianDate
    {
-    long dyear = lhs.getYear().getYear();
-    unsigned short dmonth = lhs.getMonth().getMonth();
-    unsigned short dday = lhs.getDay().getDay();
-    unsigned long days = rhs.getDays();
-    unsigned long ddays = dayDiff(lhs, JulianDate(JulianYear(lhs.getYear()), JulianMonth(12), JulianDay(31)) - Years(1)).getDays();
-    while (days >= ddays) // years
-     {
-      dday = 31;
-      dmonth = 12;
-      --dyear;
-      days -= ddays;
-      ddays = dayDiff(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)), JulianDate(JulianYear(dyear), JulianMonth(12), JulianDay(31)) - Years(1)).getDays();
-     }
-    ddays = dayDiff(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)), JulianDate(JulianYear(dyear), JulianMonth(dmonth - 1), JulianDay(JulianMonth(JulianYear(dyear), dmonth - 1).getDaysInMonth().getDays()))).getDays();
-    while (days >= ddays) // months
+    const unsigned long jd = julianToJD(lhs.getYear().getYear(), lhs.getMonth().getMonth(), lhs.getDay().getDay());
+    if (rhs.getDays() > jd - minJulianJD)
      {
-      dday = JulianMonth(JulianYear(dyear), dmonth - 1).getDaysInMonth().getDays();
-      --dmonth;
-      days -= ddays;
-      ddays = dayDiff(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)), JulianDate(JulianYear(dyear), JulianMonth(dmonth - 1), JulianDay(JulianMonth(JulianYear(dyear), dmonth - 1).getDaysInMonth().getDays()))).getDays();
+      throw std::out_of_range("year will be < 8");
      }
-    if (days > 0)
-     {
-      dday -= days;
-     }
-    return(JulianDate(JulianYear(dyear), JulianMonth(dmonth), JulianDay(dday)));
+    return(JulianDate(unchecked, JD(jd - rhs.getDays())));
    }
 
 
@@ -647,56 +644,27 @@ namespace de::powerstat::datelib
   /** @relates JulianDate
    * Operator minus to subtract a Date value from a Date.
    *
+   * Calculates the full months between both dates in constant time.
+   * The remaining days are counted from the earlier date moved by these months,
+   * whose day is limited to the last day of its month.
+   *
    * @param[in] lhs Left hand side object
    * @param[in] rhs Right hand side object
    * @return New Duration object
    */
   [[nodiscard]] constexpr auto operator-(const JulianDate &lhs, const JulianDate &rhs) -> Duration
    {
-    unsigned short day1 = 0;
-    unsigned short day2 = 0;
-    unsigned short month1 = 0;
-    unsigned short month2 = 0;
-    long year1 = 0;
-    long year2 = 0;
-    if (lhs > rhs)
-     {
-      day1 = rhs.getDay().getDay();
-      day2 = lhs.getDay().getDay();
-      month1 = rhs.getMonth().getMonth();
-      month2 = lhs.getMonth().getMonth();
-      year1 = rhs.getYear().getYear();
-      year2 = lhs.getYear().getYear();
-     }
-    else
-     {
-      day1 = lhs.getDay().getDay();
-      day2 = rhs.getDay().getDay();
-      month1 = lhs.getMonth().getMonth();
-      month2 = rhs.getMonth().getMonth();
-      year1 = lhs.getYear().getYear();
-      year2 = rhs.getYear().getYear();
-     }
-    long years = 0;
-    while (JulianDate(JulianYear(year1), JulianMonth(month1), JulianDay(day1)) + Years(1) <= JulianDate(JulianYear(year2), JulianMonth(month2), JulianDay(day2)))
-     {
-      ++years;
-      ++year1;
-     }
-    short months = 0;
-    while (JulianDate(JulianYear((month1 + 1 == 13) ? year1 + 1 : year1), JulianMonth((month1 + 1 == 13) ? 1 : month1 + 1), JulianDay(day1)) <= JulianDate(JulianYear(year2), JulianMonth(month2), JulianDay(day2)))
-     {
-      ++months;
-      ++month1;
-      if (month1 == 13)
-       {
-        month1 = 1;
-        ++year1;
-       }
-     }
-    const JulianDate date = JulianDate(JulianYear(year1), JulianMonth(month1), JulianDay(day1));
-    const Days days = dayDiff(date, JulianDate(JulianYear(year2), JulianMonth(month2), JulianDay(day2)));
-    return(Duration(Years(years), Months(months), days));
+    const JulianDate &date1 = (lhs > rhs) ? rhs : lhs;
+    const JulianDate &date2 = (lhs > rhs) ? lhs : rhs;
+    const unsigned short day1 = date1.getDay().getDay();
+    const unsigned short day2 = date2.getDay().getDay();
+    const long months = ((date2.getYear().getYear() * 12L) + date2.getMonth().getMonth()) - ((date1.getYear().getYear() * 12L) + date1.getMonth().getMonth()) - ((day2 < day1) ? 1L : 0L);
+    const long anchor = (date1.getYear().getYear() * 12L) + (date1.getMonth().getMonth() - 1L) + months;
+    const long year = anchor / 12L;
+    const unsigned short month = static_cast<unsigned short>((anchor % 12L) + 1L);
+    const unsigned short lastDay = static_cast<unsigned short>(daysOfMonth[month] + (((month == 2) && ((year % 4L) == 0)) ? 1U : 0U));
+    const unsigned long days = julianToJD(date2.getYear().getYear(), date2.getMonth().getMonth(), day2) - julianToJD(year, month, (day1 < lastDay) ? day1 : lastDay);
+    return(Duration(Years(static_cast<unsigned long>(months / 12L)), Months(static_cast<unsigned long>(months % 12L)), Days(days)));
    }
 
 
@@ -706,14 +674,26 @@ namespace de::powerstat::datelib
    * @param[in] year Julian year
    * @return JulianDate easter
    */
-  [[nodiscard]] constexpr static auto getEaster(JulianYear year) -> JulianDate
+  [[nodiscard]] constexpr static auto getEaster(JulianYear year) noexcept -> JulianDate
    {
-    const unsigned short a = static_cast<unsigned short>((19 * (year.getYear() % 19) + 15) % 30);
-    const unsigned short b = static_cast<unsigned short>((2 * (year.getYear() % 4) + 4 * (year.getYear() % 7) - a + 34) % 7);
-    const unsigned short c = static_cast<unsigned short>(a + b + 114);
-    const unsigned short dday = static_cast<unsigned short>(c % 31 + 1);
-    const unsigned short dmonth = static_cast<unsigned short>(c / 31);
-    return JulianDate(year, JulianMonth(dmonth), JulianDay(dday));
+    const YearMonthDay easter = julianEaster(year.getYear());
+    return(JulianDate(unchecked, easter.year, easter.month, easter.day));
+   }
+
+
+  /**
+   * Get easter dates for a column of years.
+   *
+   * @param[in] years Julian years
+   * @param[in] count Number of years
+   * @param[out] easters JulianDates of easter
+   */
+  inline void getEaster(const JulianYear *years, const std::size_t count, JulianDate *easters) noexcept
+   {
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      easters[i] = getEaster(years[i]);
+     }
    }
 
 
@@ -742,9 +722,18 @@ namespace de::powerstat::datelib
    */
   constexpr auto factory(const JulianYear year, const JulianWeek week, const Weekdays weekday) -> JulianDate
    {
-    const JulianDate firstday = JulianDate(year, JulianMonth(1), JulianDay(1));
-    const JulianDate diff1 = (firstday.getWeek().getWeek() > 1) ? JulianDate(JulianYear(year), JulianMonth(1), ((firstday + Weekdays::Monday)).getDay()) : (firstday - Weekdays::Monday);
-    return (diff1 + Days((week.getWeek() - 1) * 7)) + weekday;
+    // January 4th is always within the first week
+    const unsigned long monday = julianFirstJD(year.getYear()) + 3UL - julianFirstWeekShift(year.getYear());
+    const unsigned long jd = monday + ((week.getWeek() - 1UL) * 7UL) + (static_cast<unsigned long>(weekday) - 1UL);
+    if (jd < minJulianJD)
+     {
+      throw std::out_of_range("year will be < 8");
+     }
+    if (jd > maxJulianJD)
+     {
+      throw std::out_of_range("year will be > 32767");
+     }
+    return(JulianDate(unchecked, JD(jd)));
    }
 
  } // namespace
@@ -0,0 +1,455 @@
+/** @file
+ * Lazy range of dates in the julian calendar system with a stride of days, weeks, months or years.
+ * The iterators advance incrementally, so that year, month, day, weekday and JD are kept in sync without decoding.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_JULIANDATERANGE_H_
+#define DATELIB_JULIANDATERANGE_H_
+
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include "Days.h"
+#include "Weeks.h"
+#include "Months.h"
+#include "Years.h"
+#include "Weekdays.h"
+#include "JD.h"
+#include "DayNumber.h"
+#include "JulianDate.h"
+#include "Unchecked.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Rule for month and year strides when the day does not exist within the target month.
+   */
+  enum class MonthEndRule : unsigned short
+   {
+    /**
+     * Keep the day of the first date and use the last day of shorter months (01-31, 02-28, 03-31).
+     */
+    Clamp = 0,
+
+    /**
+     * Like Clamp, but a first date on the last day of a month stays on the last days of the months (02-28, 03-31, 04-30).
+     */
+    Stick = 1
+   };
+
+
+  /**
+   * Lazy range of the dates from a first to a last date (inclusive) with a fixed stride.
+   */
+  class JulianDateRange final
+   {
+    public:
+      /**
+       * Input iterator over the dates of a range.
+       */
+      class Iterator final
+       {
+        public:
+          /**
+           * Iterator category.
+           */
+          using iterator_category = std::input_iterator_tag;
+
+          /**
+           * Value type.
+           */
+          using value_type = JulianDate;
+
+          /**
+           * Difference type.
+           */
+          using difference_type = std::ptrdiff_t;
+
+          /**
+           * Pointer type.
+           */
+          using pointer = const JulianDate *;
+
+          /**
+           * Reference type, dates are returned by value.
+           */
+          using reference = JulianDate;
+
+
+          /**
+           * Current date.
+           *
+           * @return JulianDate
+           */
+          [[nodiscard]] constexpr auto operator*() const noexcept -> JulianDate
+           {
+            return(JulianDate(unchecked, this->year, this->month, this->day));
+           }
+
+
+          /**
+           * JD of the current date.
+           *
+           * @return JD
+           */
+          [[nodiscard]] constexpr auto getJD() const noexcept -> JD
+           {
+            return(JD(this->jd));
+           }
+
+
+          /**
+           * Weekday of the current date.
+           *
+           * @return Weekday
+           */
+          [[nodiscard]] constexpr auto getWeekday() const noexcept -> Weekdays
+           {
+            return(Weekdays(this->weekday));
+           }
+
+
+          /**
+           * Advance to the next date.
+           *
+           * @return This iterator
+           */
+          constexpr auto operator++() noexcept -> Iterator&
+           {
+            ++this->index;
+            if (this->monthly)
+             {
+              const unsigned long months = this->month - 1UL + this->stride;
+              this->year += static_cast<long>(months / 12UL);
+              this->month = static_cast<unsigned short>((months % 12UL) + 1UL);
+              const unsigned short daysInMonth = julianDaysInMonth(this->year, this->month);
+              this->day = (this->anchorDay < daysInMonth) ? this->anchorDay : daysInMonth;
+              this->jd = julianFirstJD(this->year) + julianDayWithinYear(this->year, this->month, this->day) - 1UL;
+              this->weekday = jdToWeekday(this->jd);
+              return(*this);
+             }
+            this->jd += this->stride;
+            this->weekday = static_cast<unsigned short>(this->weekday + this->strideWeekdays);
+            if (this->weekday > 7)
+             {
+              this->weekday -= 7;
+             }
+            if (this->stride > 28)
+             {
+              const YearMonthDay ymd = jdToJulian(this->jd);
+              this->year = ymd.year;
+              this->month = ymd.month;
+              this->day = ymd.day;
+              return(*this);
+             }
+            // A stride of at most 28 days crosses at most one month end
+            this->day = static_cast<unsigned short>(this->day + this->stride);
+            const unsigned short daysInMonth = julianDaysInMonth(this->year, this->month);
+            if (this->day > daysInMonth)
+             {
+              this->day -= daysInMonth;
+              if (++this->month > 12)
+               {
+                this->month = 1;
+                ++this->year;
+               }
+             }
+            return(*this);
+           }
+
+
+          /**
+           * Advance to the next date.
+           *
+           * @return Iterator before advancing
+           */
+          constexpr auto operator++(int) noexcept -> Iterator
+           {
+            const Iterator result = *this;
+            ++*this;
+            return(result);
+           }
+
+
+          /**
+           * Operator equal to compare two iterators of the same range.
+           *
+           * @param[in] lhs Left hand side object
+           * @param[in] rhs Right hand side object
+           * @return true when both iterators are at the same position.
+           */
+          [[nodiscard]] friend constexpr auto operator==(const Iterator &lhs, const Iterator &rhs) noexcept -> bool
+           {
+            return(lhs.index == rhs.index);
+           }
+
+
+          /**
+           * Operator not equal to compare two iterators of the same range.
+           *
+           * @param[in] lhs Left hand side object
+           * @param[in] rhs Right hand side object
+           * @return true when both iterators are at different positions.
+           */
+          [[nodiscard]] friend constexpr auto operator!=(const Iterator &lhs, const Iterator &rhs) noexcept -> bool
+           {
+            return(!(lhs == rhs));
+           }
+
+        private:
+          friend class JulianDateRange;
+
+          /**
+           * Constructor.
+           *
+           * @param[in] range Range to iterate
+           * @param[in] index Position within the range
+           */
+          constexpr explicit Iterator(const JulianDateRange &range, const std::size_t index) noexcept
+           : year(range.first.getYear().getYear()), jd(range.first.getJD().getJD()), stride(range.stride), index(index), month(range.first.getMonth().getMonth()), day(range.first.getDay().getDay()), anchorDay(range.anchorDay), weekday(jdToWeekday(jd)), strideWeekdays(static_cast<unsigned short>(range.stride % 7UL)), monthly(range.monthly)
+           {
+           }
+
+
+          /**
+           * Number of days within a month.
+           *
+           * @param[in] year Year
+           * @param[in] month Month (1-12)
+           * @return Number of days (28-31)
+           */
+          [[nodiscard]] static constexpr auto julianDaysInMonth(const long year, const unsigned short month) noexcept -> unsigned short
+           {
+            return(static_cast<unsigned short>(daysOfMonth[month] + (((month == 2) && ((year % 4) == 0)) ? 1U : 0U)));
+           }
+
+
+          long year;
+          unsigned long jd;
+          unsigned long stride;
+          std::size_t index;
+          unsigned short month;
+          unsigned short day;
+          unsigned short anchorDay;
+          unsigned short weekday;
+          unsigned short strideWeekdays;
+          bool monthly;
+
+       };
+
+
+      /**
+       * Constructor for a daily range.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date (inclusive), a range with last < first is empty
+       */
+      constexpr JulianDateRange(const JulianDate &first, const JulianDate &last) noexcept
+       : first(first), stride(1), count(countDays(first, last, 1)), anchorDay(first.getDay().getDay()), monthly(false)
+       {
+       }
+
+
+      /**
+       * Constructor for a range with a stride of days.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date (inclusive), a range with last < first is empty
+       * @param[in] step Stride
+       * @throws std::out_of_range When step is 0
+       */
+      constexpr JulianDateRange(const JulianDate &first, const JulianDate &last, const Days &step)
+       : first(first), stride(checkStride(step.getDays(), 1)), count(countDays(first, last, stride)), anchorDay(first.getDay().getDay()), monthly(false)
+       {
+       }
+
+
+      /**
+       * Constructor for a range with a stride of weeks.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date (inclusive), a range with last < first is empty
+       * @param[in] step Stride
+       * @throws std::out_of_range When step is 0
+       */
+      constexpr JulianDateRange(const JulianDate &first, const JulianDate &last, const Weeks &step)
+       : first(first), stride(checkStride(step.getWeeks(), 7)), count(countDays(first, last, stride)), anchorDay(first.getDay().getDay()), monthly(false)
+       {
+       }
+
+
+      /**
+       * Constructor for a range with a stride of months.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date (inclusive), a range with last < first is empty
+       * @param[in] step Stride
+       * @param[in] rule Rule for days that do not exist within shorter months
+       * @throws std::out_of_range When step is 0
+       */
+      constexpr JulianDateRange(const JulianDate &first, const JulianDate &last, const Months &step, const MonthEndRule rule = MonthEndRule::Clamp)
+       : first(first), stride(checkStride(step.getMonths(), 1)), count(0), anchorDay(anchor(first, rule)), monthly(true)
+       {
+        this->count = countMonths(first, last, this->stride, this->anchorDay);
+       }
+
+
+      /**
+       * Constructor for a range with a stride of years.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date (inclusive), a range with last < first is empty
+       * @param[in] step Stride
+       * @param[in] rule Rule for february 29th within common years
+       * @throws std::out_of_range When step is 0
+       */
+      constexpr JulianDateRange(const JulianDate &first, const JulianDate &last, const Years &step, const MonthEndRule rule = MonthEndRule::Clamp)
+       : first(first), stride(checkStride(step.getYears(), 12)), count(0), anchorDay(anchor(first, rule)), monthly(true)
+       {
+        this->count = countMonths(first, last, this->stride, this->anchorDay);
+       }
+
+
+      /**
+       * Iterator to the first date.
+       *
+       * @return Iterator
+       */
+      [[nodiscard]] constexpr auto begin() const noexcept -> Iterator
+       {
+        return(Iterator(*this, 0));
+       }
+
+
+      /**
+       * Iterator behind the last date.
+       *
+       * @return Iterator
+       */
+      [[nodiscard]] constexpr auto end() const noexcept -> Iterator
+       {
+        return(Iterator(*this, this->count));
+       }
+
+
+      /**
+       * Number of dates within the range.
+       *
+       * @return Number of dates
+       */
+      [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+       {
+        return(this->count);
+       }
+
+
+      /**
+       * Is the range empty.
+       *
+       * @return true: no dates, false: otherwise
+       */
+      [[nodiscard]] constexpr auto empty() const noexcept -> bool
+       {
+        return(this->count == 0);
+       }
+
+    private:
+      /**
+       * Check and scale a stride.
+       *
+       * Strides that are larger than the supported date range are reduced to it, because they result in a single date anyway.
+       *
+       * @param[in] step Stride in units
+       * @param[in] factor Days or months per unit
+       * @return Stride in days or months
+       * @throws std::out_of_range When step is 0
+       */
+      static constexpr auto checkStride(const unsigned long step, const unsigned long factor) -> unsigned long
+       {
+        if (step == 0)
+         {
+          throw std::out_of_range("step is 0");
+         }
+        return((step > maxJulianJD) ? maxJulianJD : step * factor);
+       }
+
+
+      /**
+       * Day of month that is kept for month and year strides.
+       *
+       * @param[in] first First date
+       * @param[in] rule Month end rule
+       * @return Day (1-31)
+       */
+      static constexpr auto anchor(const JulianDate &first, const MonthEndRule rule) noexcept -> unsigned short
+       {
+        const unsigned short day = first.getDay().getDay();
+        return(((rule == MonthEndRule::Stick) && (day == first.getMonth().getDaysInMonth().getDays())) ? 31 : day);
+       }
+
+
+      /**
+       * Number of dates for a stride of days.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date
+       * @param[in] stride Stride in days
+       * @return Number of dates
+       */
+      static constexpr auto countDays(const JulianDate &first, const JulianDate &last, const unsigned long stride) noexcept -> std::size_t
+       {
+        const unsigned long firstJD = first.getJD().getJD();
+        const unsigned long lastJD = last.getJD().getJD();
+        return((lastJD < firstJD) ? 0 : static_cast<std::size_t>(((lastJD - firstJD) / stride) + 1UL));
+       }
+
+
+      /**
+       * Number of dates for a stride of months.
+       *
+       * @param[in] first First date
+       * @param[in] last Last date
+       * @param[in] stride Stride in months
+       * @param[in] anchorDay Day of month that is kept
+       * @return Number of dates
+       */
+      static constexpr auto countMonths(const JulianDate &first, const JulianDate &last, const unsigned long stride, const unsigned short anchorDay) noexcept -> std::size_t
+       {
+        if (last < first)
+         {
+          return(0);
+         }
+        const unsigned long firstMonth = (static_cast<unsigned long>(first.getYear().getYear()) * 12UL) + first.getMonth().getMonth() - 1UL;
+        const unsigned long lastMonth = (static_cast<unsigned long>(last.getYear().getYear()) * 12UL) + last.getMonth().getMonth() - 1UL;
+        unsigned long steps = (lastMonth - firstMonth) / stride;
+        const unsigned long month = firstMonth + (steps * stride);
+        if (month == lastMonth)
+         {
+          // The date within the last month could be behind the last date
+          const unsigned short daysInMonth = Iterator::julianDaysInMonth(static_cast<long>(month / 12UL), static_cast<unsigned short>((month % 12UL) + 1UL));
+          if (((anchorDay < daysInMonth) ? anchorDay : daysInMonth) > last.getDay().getDay())
+           {
+            --steps;
+           }
+         }
+        return(static_cast<std::size_t>(steps + 1UL));
+       }
+
+
+      JulianDate first;
+      unsigned long stride;
+      std::size_t count;
+      unsigned short anchorDay;
+      bool monthly;
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_JULIANDATERANGE_H_
@@ -9,10 +9,13 @@
 
 
 #include <ostream>
+#include <cassert>
 #include <stdexcept>
 #include <string>
 #include "Days.h"
 #include "JulianMonth.h"
+#include "Expected.h"
+#include "Unchecked.h"
 
 
 /** @namespace de::powerstat::datelib
@@ -60,6 +63,54 @@ namespace de::powerstat::datelib
        }
 
 
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] day Day number (1-31)
+       */
+      constexpr explicit JulianDay([[maybe_unused]] const Unchecked tag, const unsigned short day) noexcept
+       : day{day}
+       {
+        assert(day >= 1 && day <= 31);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] day Day number (1-31)
+       * @return JulianDay or ValidationError::DayOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const unsigned short day) noexcept -> Expected<JulianDay>
+       {
+        if (day < 1 || day > 31)
+         {
+          return(Expected<JulianDay>(ValidationError::DayOutOfRange));
+         }
+        return(Expected<JulianDay>(JulianDay(unchecked, day)));
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] month Month number (1 - 12)
+       * @param[in] day Day number (1 - max days in month) depending on the month
+       * @return JulianDay or ValidationError::DayOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const JulianMonth month, const unsigned short day) noexcept -> Expected<JulianDay>
+       {
+        if (day < 1 || day > month.getDaysInMonth().getDays())
+         {
+          return(Expected<JulianDay>(ValidationError::DayOutOfRange));
+         }
+        return(Expected<JulianDay>(JulianDay(unchecked, day)));
+       }
+
+
       /**
        * Copy constructor.
        *
@@ -85,7 +136,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another day object to be assigned to this object.
        * @return JulianDay
        */
-      auto operator=(const JulianDay &other) & noexcept -> JulianDay& = delete;
+      constexpr auto operator=(const JulianDay &other) & noexcept -> JulianDay& = default;
 
       /**
        * Move assignment operator for another Day object.
@@ -93,7 +144,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another day object to be assigned to this object.
        * @return JulianDay&
        */
-      auto operator=(JulianDay&& other) & noexcept -> JulianDay& = delete;
+      constexpr auto operator=(JulianDay&& other) & noexcept -> JulianDay& = default;
 
 
       /**
@@ -107,7 +158,7 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const unsigned short day;
+      unsigned short day;
 
    };
 
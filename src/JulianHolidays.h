@@ -0,0 +1,217 @@
+/** @file
+ * Set of holiday rules in the julian calendar system with a per year bitset cache.
+ * The holidays of 64 years are materialized on first use and published lock free,
+ * so that a lookup in a loaded year is an atomic load and a single bit probe.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_JULIANHOLIDAYS_H_
+#define DATELIB_JULIANHOLIDAYS_H_
+
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "JD.h"
+#include "JulianYear.h"
+#include "JulianDate.h"
+#include "Unchecked.h"
+#include "HolidayRule.h"
+#include "DayNumber.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Holidays of one year, bit n - 1 is set when day n within the year is a holiday.
+   */
+  using HolidaySet = std::array<std::uint64_t, 6>;
+
+
+  /**
+   * Set of holiday rules.
+   *
+   * The object is safe to use from multiple threads. It could not be copied or moved, because the cache is shared by all threads.
+   */
+  class JulianHolidays final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] rules Holiday rules
+       * @param[in] count Number of rules
+       */
+      JulianHolidays(const HolidayRule *rules, const std::size_t count)
+       : rules(rules, rules + count)
+       {
+       }
+
+
+      /**
+       * Copy constructor.
+       *
+       * @param[in] other Another JulianHolidays object to copy from.
+       */
+      JulianHolidays(const JulianHolidays &other) = delete;
+
+      /**
+       * Move constructor.
+       *
+       * @param[in] other Another JulianHolidays object to move from.
+       */
+      JulianHolidays(JulianHolidays&& other) = delete;
+
+      /**
+       * Destructor.
+       */
+      ~JulianHolidays() noexcept
+       {
+        for (std::atomic<const Chunk *> &chunk : this->chunks)
+         {
+          delete chunk.load(std::memory_order_relaxed);
+         }
+       }
+
+      /**
+       * Assignment operator for another JulianHolidays object.
+       *
+       * @param[in] other Another JulianHolidays object to be assigned to this object.
+       */
+      auto operator=(const JulianHolidays &other) -> JulianHolidays& = delete;
+
+      /**
+       * Move assignment operator for another JulianHolidays object.
+       *
+       * @param[in] other Another JulianHolidays object to be assigned to this object.
+       */
+      auto operator=(JulianHolidays&& other) -> JulianHolidays& = delete;
+
+
+      /**
+       * Get the holidays of a year.
+       *
+       * @param[in] year Year
+       * @return Holidays, the reference stays valid for the lifetime of this object
+       */
+      [[nodiscard]] auto getHolidays(const JulianYear year) const -> const HolidaySet&
+       {
+        const auto index = static_cast<unsigned long>(year.getYear());
+        return((*chunk(index / yearsPerChunk))[index % yearsPerChunk]);
+       }
+
+
+      /**
+       * Is a date a holiday.
+       *
+       * @param[in] date Date
+       * @return true when date is a holiday, false otherwise
+       */
+      [[nodiscard]] auto isHoliday(const JulianDate &date) const -> bool
+       {
+        const unsigned long day = date.getDayWithinYear().getDays() - 1UL;
+        return(((getHolidays(date.getYear())[day / 64] >> (day % 64)) & 1U) != 0);
+       }
+
+
+      /**
+       * Is a day a holiday.
+       *
+       * @param[in] jd JD (1723980-13689569)
+       * @return true when jd is a holiday, false otherwise
+       */
+      [[nodiscard]] auto isHoliday(const JD jd) const -> bool
+       {
+        return(isHoliday(JulianDate(unchecked, jd)));
+       }
+
+
+      /**
+       * Append the holidays of a year as JD numbers, i.e. to build a BusinessCalendar.
+       *
+       * @param[in] year Year
+       * @param[in,out] holidays Holidays in ascending order are appended to this vector
+       */
+      void appendHolidays(const JulianYear year, std::vector<JD> &holidays) const
+       {
+        const HolidaySet &set = getHolidays(year);
+        const unsigned long firstJD = julianFirstJD(year.getYear());
+        for (std::size_t word = 0; word < set.size(); ++word)
+         {
+          for (unsigned long bit = 0; bit < 64; ++bit)
+           {
+            if (((set[word] >> bit) & 1U) != 0)
+             {
+              holidays.emplace_back(firstJD + (word * 64UL) + bit);
+             }
+           }
+         }
+       }
+
+    private:
+      /**
+       * Number of years that are materialized together.
+       */
+      static constexpr unsigned long yearsPerChunk = 64;
+
+      /**
+       * Holidays of yearsPerChunk years.
+       */
+      using Chunk = std::array<HolidaySet, yearsPerChunk>;
+
+      std::vector<HolidayRule> rules;
+      mutable std::array<std::atomic<const Chunk *>, (32767 / yearsPerChunk) + 1> chunks {};
+
+
+      /**
+       * Get a chunk and materialize it on first use.
+       *
+       * Concurrent first uses could build the same chunk, only one of them is published.
+       *
+       * @param[in] index Chunk index (year / yearsPerChunk)
+       * @return Chunk
+       */
+      [[nodiscard]] auto chunk(const unsigned long index) const -> const Chunk *
+       {
+        const Chunk *loaded = this->chunks[index].load(std::memory_order_acquire);
+        if (loaded != nullptr)
+         {
+          return(loaded);
+         }
+        auto built = std::make_unique<Chunk>();
+        for (unsigned long i = 0; i < yearsPerChunk; ++i)
+         {
+          const auto year = static_cast<long>((index * yearsPerChunk) + i);
+          HolidaySet &set = (*built)[i];
+          set.fill(0);
+          if (year < 8)
+           {
+            continue;
+           }
+          for (const HolidayRule &rule : this->rules)
+           {
+            const unsigned short day = rule.getDayWithinYear(year);
+            if (day != 0)
+             {
+              set[(day - 1U) / 64U] |= std::uint64_t{1} << ((day - 1U) % 64U);
+             }
+           }
+         }
+        if (this->chunks[index].compare_exchange_strong(loaded, built.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+         {
+          return(built.release());
+         }
+        return(loaded);
+       }
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_JULIANHOLIDAYS_H_
@@ -9,10 +9,13 @@
 
 
 #include <ostream>
+#include <cassert>
 #include <stdexcept>
 #include "Days.h"
 #include "Months.h"
 #include "JulianYear.h"
+#include "Expected.h"
+#include "Unchecked.h"
 
 
 /** @namespace de::powerstat::datelib
@@ -59,6 +62,70 @@ namespace de::powerstat::datelib
        }
 
 
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] month Month number (1-12)
+       */
+      constexpr explicit JulianMonth([[maybe_unused]] const Unchecked tag, const unsigned short month) noexcept
+       : leapYear(false), month(month)
+       {
+        assert(month >= 1 && month <= 12);
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] year Year number (8-32767)
+       * @param[in] month Month number (1-12)
+       */
+      constexpr explicit JulianMonth([[maybe_unused]] const Unchecked tag, const JulianYear year, const unsigned short month) noexcept
+       : leapYear(year.isLeapYear()), month(month)
+       {
+        assert(month >= 1 && month <= 12);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] month Month number (1-12)
+       * @return JulianMonth or ValidationError::MonthOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const unsigned short month) noexcept -> Expected<JulianMonth>
+       {
+        if (month < 1 || month > 12)
+         {
+          return(Expected<JulianMonth>(ValidationError::MonthOutOfRange));
+         }
+        return(Expected<JulianMonth>(JulianMonth(unchecked, month)));
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] year Year number (8-32767)
+       * @param[in] month Month number (1-12)
+       * @return JulianMonth or ValidationError::MonthOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const JulianYear year, const unsigned short month) noexcept -> Expected<JulianMonth>
+       {
+        if (month < 1 || month > 12)
+         {
+          return(Expected<JulianMonth>(ValidationError::MonthOutOfRange));
+         }
+        return(Expected<JulianMonth>(JulianMonth(unchecked, year, month)));
+       }
+
+
       /**
        * Copy constructor.
        *
@@ -83,7 +150,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another month object to be assigned to this object.
        */
-      auto operator=(const JulianMonth &other) & noexcept -> JulianMonth& = delete;
+      constexpr auto operator=(const JulianMonth &other) & noexcept -> JulianMonth& = default;
 
       /**
        * Move assignment operator for another Month object.
@@ -91,7 +158,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another month object to be assigned to this object.
        * @return Month&
        */
-      auto operator=(JulianMonth&& other) & noexcept -> JulianMonth& = delete;
+      constexpr auto operator=(JulianMonth&& other) & noexcept -> JulianMonth& = default;
 
       /**
        * Get month number as primitive data type.
@@ -134,8 +201,8 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const bool leapYear;
-      const unsigned short month;
+      bool leapYear;
+      unsigned short month;
 
    };
 
@@ -0,0 +1,595 @@
+/** @file
+ * Lazy expansion of a recurrence rule in the julian calendar system.
+ * The occurrences of each period are collected as bits of a day mask relative to the first day of the period,
+ * so that they are calculated from JD numbers without validating dates.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_JULIANRECURRENCE_H_
+#define DATELIB_JULIANRECURRENCE_H_
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include "Bits.h"
+#include "JD.h"
+#include "DayNumber.h"
+#include "JulianDate.h"
+#include "RecurrenceRule.h"
+#include "Unchecked.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Lazy range of the occurrences of a recurrence rule from a start date on.
+   *
+   * Occurrences before the start date are left out, the start date itself is only an occurrence when it matches the rule.
+   * Weekly periods start on monday. BYMONTHDAY is ignored for weekly rules, for yearly rules it applies to every month.
+   */
+  class JulianRecurrence final
+   {
+    public:
+      /**
+       * Input iterator over the occurrences.
+       */
+      class Iterator final
+       {
+        public:
+          /**
+           * Iterator category.
+           */
+          using iterator_category = std::input_iterator_tag;
+
+          /**
+           * Value type.
+           */
+          using value_type = JulianDate;
+
+          /**
+           * Difference type.
+           */
+          using difference_type = std::ptrdiff_t;
+
+          /**
+           * Pointer type.
+           */
+          using pointer = const JulianDate *;
+
+          /**
+           * Reference type, dates are returned by value.
+           */
+          using reference = JulianDate;
+
+
+          /**
+           * Current occurrence.
+           *
+           * @return JulianDate
+           */
+          [[nodiscard]] auto operator*() const noexcept -> JulianDate
+           {
+            // Monthly periods already know their year and month
+            const unsigned long day = this->jd - this->periodJD;
+            return((day < this->monthLength) ? JulianDate(unchecked, this->year, this->month, static_cast<unsigned short>(day + 1UL)) : JulianDate(unchecked, JD(this->jd)));
+           }
+
+
+          /**
+           * JD of the current occurrence.
+           *
+           * @return JD
+           */
+          [[nodiscard]] auto getJD() const noexcept -> JD
+           {
+            return(JD(this->jd));
+           }
+
+
+          /**
+           * Advance to the next occurrence.
+           *
+           * @return This iterator
+           */
+          auto operator++() noexcept -> Iterator&
+           {
+            next();
+            return(*this);
+           }
+
+
+          /**
+           * Advance to the next occurrence.
+           *
+           * @return Iterator before advancing
+           */
+          auto operator++(int) noexcept -> Iterator
+           {
+            const Iterator result = *this;
+            next();
+            return(result);
+           }
+
+
+          /**
+           * Operator equal to compare two iterators of the same recurrence.
+           *
+           * @param[in] lhs Left hand side object
+           * @param[in] rhs Right hand side object
+           * @return true when both iterators are at the end or at the same occurrence.
+           */
+          [[nodiscard]] friend auto operator==(const Iterator &lhs, const Iterator &rhs) noexcept -> bool
+           {
+            return((lhs.done == rhs.done) && (lhs.done || (lhs.jd == rhs.jd)));
+           }
+
+
+          /**
+           * Operator not equal to compare two iterators of the same recurrence.
+           *
+           * @param[in] lhs Left hand side object
+           * @param[in] rhs Right hand side object
+           * @return true when the iterators are at different occurrences.
+           */
+          [[nodiscard]] friend auto operator!=(const Iterator &lhs, const Iterator &rhs) noexcept -> bool
+           {
+            return(!(lhs == rhs));
+           }
+
+        private:
+          friend class JulianRecurrence;
+
+          /**
+           * Day mask for a period of up to 366 days, daily, weekly and monthly periods only use the first word.
+           */
+          using DayMask = std::array<std::uint64_t, 6>;
+
+
+          /**
+           * Constructor.
+           *
+           * @param[in] recurrence Recurrence to iterate, must live longer than the iterator
+           * @param[in] done true: end iterator, false: iterator at the first occurrence
+           */
+          explicit Iterator(const JulianRecurrence &recurrence, const bool done) noexcept
+           : recurrence(&recurrence), done(done)
+           {
+            if (done)
+             {
+              return;
+             }
+            const JulianDate &start = recurrence.start;
+            this->year = start.getYear().getYear();
+            this->month = start.getMonth().getMonth();
+            switch (recurrence.rule.getFrequency())
+             {
+              case Frequency::Daily :
+                this->periodJD = recurrence.startJD;
+                break;
+              case Frequency::Weekly :
+                this->periodJD = recurrence.startJD - jdToWeekday(recurrence.startJD) + 1UL;
+                break;
+              case Frequency::Monthly :
+                this->periodJD = julianToJD(this->year, this->month, 1);
+                break;
+              case Frequency::Yearly :
+                this->periodJD = julianFirstJD(this->year);
+                break;
+             }
+            fillPeriod();
+            next();
+           }
+
+
+          /**
+           * Days of a set of weekdays within 64 days.
+           *
+           * @param[in] firstWeekday Weekday of the first day (1-7)
+           * @param[in] weekdays Set of weekdays, bit n for weekday n
+           * @return Bit n is set when day n is on one of the weekdays
+           */
+          [[nodiscard]] static constexpr auto weekdayBits(const unsigned short firstWeekday, const unsigned short weekdays) noexcept -> std::uint64_t
+           {
+            // The pattern of one week repeats every 7 bits
+            const std::uint64_t set = (weekdays >> 1U) & 0x7FU;
+            const unsigned short shift = static_cast<unsigned short>(firstWeekday - 1U);
+            return((((set >> shift) | (set << (7U - shift))) & 0x7FU) * 0x8102040810204081ULL);
+           }
+
+
+          /**
+           * Mask for the days of a period within one word.
+           *
+           * @param[in] days Days within the period that start within this word
+           * @return Bits 0 to days - 1
+           */
+          [[nodiscard]] static constexpr auto lowBits(const unsigned long days) noexcept -> std::uint64_t
+           {
+            return((days >= 64U) ? ~std::uint64_t{0} : ((std::uint64_t{1} << days) - 1U));
+           }
+
+
+          /**
+           * Days of a month.
+           *
+           * @param[in] daysInMonth Days within the month (28-31)
+           * @param[in] monthDays Set of days, bit n for day n (1-31)
+           * @param[in] lastMonthDays Set of days, bit n for the n-th last day (1-31)
+           * @param[in] skip Handling of days > daysInMonth
+           * @return Bit n - 1 is set for day n
+           */
+          [[nodiscard]] static constexpr auto monthDayBits(const unsigned long daysInMonth, const std::uint32_t monthDays, const std::uint32_t lastMonthDays, const SkipRule skip) noexcept -> std::uint64_t
+           {
+            // Invalid days are above daysInMonth
+            const std::uint32_t validDays = static_cast<std::uint32_t>((std::uint64_t{2} << daysInMonth) - 1U);
+            std::uint64_t bits = (monthDays & validDays) >> 1U;
+            if (((monthDays & ~validDays) != 0) && (skip == SkipRule::Backward))
+             {
+              bits |= std::uint64_t{1} << (daysInMonth - 1U);
+             }
+            for (std::uint32_t days = lastMonthDays & validDays; days != 0; days &= days - 1U)
+             {
+              bits |= std::uint64_t{1} << (daysInMonth - lowestBit(days));
+             }
+            return(bits);
+           }
+
+
+          /**
+           * Day of the n-th or n-th last day of a weekday.
+           *
+           * @param[in] firstWeekday Weekday of the first day of the period (1-7)
+           * @param[in] length Days within the period
+           * @param[in] weekday Weekday
+           * @param[in] ordinal n (1-53) or -n (-53 to -1)
+           * @return Day within the period (0-365) or -1 when it does not occur
+           */
+          [[nodiscard]] static constexpr auto ordinalWeekdayDay(const unsigned short firstWeekday, const unsigned long length, const Weekdays weekday, const long ordinal) noexcept -> long
+           {
+            const long first = static_cast<long>((static_cast<unsigned short>(weekday) + 7U - firstWeekday) % 7U);
+            const long last = first + (7L * ((static_cast<long>(length) - 1L - first) / 7L));
+            const long day = (ordinal > 0) ? first + (7L * (ordinal - 1L)) : last + (7L * (ordinal + 1L));
+            return(((day >= 0) && (day < static_cast<long>(length))) ? day : -1L);
+           }
+
+
+          /**
+           * Set days of a year.
+           *
+           * @param[in,out] mask Day mask
+           * @param[in] offset Day of bit 0 within the year (0-365)
+           * @param[in] bits Days of up to one month
+           */
+          static void setDays(DayMask &mask, const unsigned long offset, const std::uint64_t bits) noexcept
+           {
+            const unsigned long word = offset / 64U;
+            const unsigned long shift = offset % 64U;
+            mask[word] |= bits << shift;
+            if ((shift != 0) && (word + 1U < mask.size()))
+             {
+              mask[word + 1U] |= bits >> (64U - shift);
+             }
+           }
+
+
+          /**
+           * Keep only the BYSETPOS positions of the days within a mask.
+           *
+           * Positive positions are counted from the lowest and negative ones from the highest word,
+           * so that the first and last day are a single bit scan.
+           *
+           * @param[in,out] mask Day mask
+           * @param[in] words Used words of the mask
+           * @param[in] rule Recurrence rule
+           */
+          static void selectPositions(DayMask &mask, const unsigned short words, const RecurrenceRule &rule) noexcept
+           {
+            DayMask selected;
+            for (unsigned short word = 0; word < words; ++word)
+             {
+              selected[word] = 0;
+             }
+            for (unsigned short i = 0; i < rule.getSetPositionCount(); ++i)
+             {
+              const long position = rule.getSetPosition(i);
+              // Number of days to skip from the lowest (positive) or highest (negative) day on
+              auto rank = static_cast<unsigned short>(((position > 0) ? position : -position) - 1L);
+              for (unsigned short n = 0; n < words; ++n)
+               {
+                const unsigned short word = (position > 0) ? n : static_cast<unsigned short>(words - 1U - n);
+                const std::uint64_t bits = mask[word];
+                if ((rank == 0) && (bits != 0))
+                 {
+                  selected[word] |= std::uint64_t{1} << ((position > 0) ? lowestBit(bits) : highestBit(bits));
+                  break;
+                 }
+                const unsigned short days = popcount(bits);
+                if (rank < days)
+                 {
+                  selected[word] |= std::uint64_t{1} << selectBit(bits, (position > 0) ? rank : static_cast<unsigned short>(days - 1U - rank));
+                  break;
+                 }
+                rank = static_cast<unsigned short>(rank - days);
+               }
+             }
+            for (unsigned short word = 0; word < words; ++word)
+             {
+              mask[word] = selected[word];
+             }
+           }
+
+
+          /**
+           * Collect the occurrences of the current period into the day mask.
+           */
+          void fillPeriod() noexcept
+           {
+            const JulianRecurrence &recurrence = *this->recurrence;
+            const RecurrenceRule &rule = recurrence.rule;
+            const unsigned short firstWeekday = jdToWeekday(this->periodJD);
+            this->word = 0;
+            this->words = 1;
+            switch (rule.getFrequency())
+             {
+              case Frequency::Daily :
+               {
+                bool match = !recurrence.byDay || (((recurrence.weekdays >> firstWeekday) & 1U) != 0);
+                if (match && recurrence.byMonthDay)
+                 {
+                  const YearMonthDay ymd = jdToJulian(this->periodJD);
+                  const unsigned long daysInMonth = daysOfMonth[ymd.month] + (((ymd.month == 2) && ((ymd.year % 4) == 0)) ? 1UL : 0UL);
+                  match = ((recurrence.monthDays[daysInMonth - 28U] >> (ymd.day - 1U)) & 1U) != 0;
+                 }
+                this->mask[0] = match ? 1U : 0U;
+                break;
+               }
+              case Frequency::Weekly :
+                this->mask[0] = weekdayBits(firstWeekday, recurrence.byDay ? recurrence.weekdays : static_cast<unsigned short>(1U << jdToWeekday(recurrence.startJD))) & 0x7FU;
+                break;
+              case Frequency::Monthly :
+               {
+                const unsigned long length = daysOfMonth[this->month] + (((this->month == 2) && ((this->year % 4) == 0)) ? 1UL : 0UL);
+                this->monthLength = length;
+                if (recurrence.byMonthDay || !recurrence.byDay)
+                 {
+                  this->mask[0] = recurrence.monthDays[length - 28U] & (recurrence.byDay ? weekdayBits(firstWeekday, recurrence.weekdays) : ~std::uint64_t{0});
+                 }
+                else
+                 {
+                  this->mask[0] = weekdayBits(firstWeekday, rule.getWeekdays()) & lowBits(length);
+                  for (unsigned short i = 0; i < rule.getOrdinalCount(); ++i)
+                   {
+                    const long day = ordinalWeekdayDay(firstWeekday, length, rule.getOrdinalWeekday(i), rule.getOrdinal(i));
+                    this->mask[0] |= (day >= 0) ? (std::uint64_t{1} << day) : 0U;
+                   }
+                 }
+                break;
+               }
+              case Frequency::Yearly :
+                fillYear(firstWeekday);
+                break;
+             }
+            if (rule.getSetPositionCount() != 0)
+             {
+              selectPositions(this->mask, this->words, rule);
+             }
+           }
+
+
+          /**
+           * Collect the occurrences of a yearly period into the day mask.
+           *
+           * @param[in] firstWeekday Weekday of january 1st (1-7)
+           */
+          void fillYear(const unsigned short firstWeekday) noexcept
+           {
+            const JulianRecurrence &recurrence = *this->recurrence;
+            const RecurrenceRule &rule = recurrence.rule;
+            const bool leapYear = (this->year % 4) == 0;
+            const unsigned long length = leapYear ? 366 : 365;
+            const std::array<unsigned long, 14> &daysBefore = leapYear ? daysBeforeMonthInLeapYear : daysBeforeMonth;
+            this->words = static_cast<unsigned short>((length + 63U) / 64U);
+            this->mask = DayMask {};
+            if (recurrence.byMonthDay || !recurrence.byDay)
+             {
+              const unsigned short firstMonth = recurrence.byMonthDay ? 1 : recurrence.start.getMonth().getMonth();
+              const unsigned short lastMonth = recurrence.byMonthDay ? 12 : firstMonth;
+              for (unsigned short month = firstMonth; month <= lastMonth; ++month)
+               {
+                setDays(this->mask, daysBefore[month], recurrence.monthDays[daysOfMonth[month] + (((month == 2) && leapYear) ? 1UL : 0UL) - 28U]);
+               }
+             }
+            // 64 days are 9 weeks and 1 day
+            unsigned short weekday = firstWeekday;
+            for (unsigned short word = 0; word < this->words; ++word)
+             {
+              if (recurrence.byMonthDay)
+               {
+                this->mask[word] &= recurrence.byDay ? weekdayBits(weekday, recurrence.weekdays) : ~std::uint64_t{0};
+               }
+              else if (recurrence.byDay)
+               {
+                this->mask[word] = weekdayBits(weekday, rule.getWeekdays()) & lowBits(length - (word * 64U));
+               }
+              weekday = static_cast<unsigned short>((weekday % 7U) + 1U);
+             }
+            if (!recurrence.byMonthDay && recurrence.byDay)
+             {
+              for (unsigned short i = 0; i < rule.getOrdinalCount(); ++i)
+               {
+                const long day = ordinalWeekdayDay(firstWeekday, length, rule.getOrdinalWeekday(i), rule.getOrdinal(i));
+                if (day >= 0)
+                 {
+                  this->mask[static_cast<unsigned long>(day) / 64U] |= std::uint64_t{1} << (static_cast<unsigned long>(day) % 64U);
+                 }
+               }
+             }
+           }
+
+
+          /**
+           * Move to the next period.
+           *
+           * @return false: behind the supported range, true: otherwise
+           */
+          auto nextPeriod() noexcept -> bool
+           {
+            const unsigned long interval = this->recurrence->rule.getInterval();
+            if (interval > maxJulianJD)
+             {
+              return(false);
+             }
+            switch (this->recurrence->rule.getFrequency())
+             {
+              case Frequency::Daily :
+                this->periodJD += interval;
+                break;
+              case Frequency::Weekly :
+                this->periodJD += 7UL * interval;
+                break;
+              case Frequency::Monthly :
+               {
+                const unsigned long months = this->month - 1UL + interval;
+                this->year += static_cast<long>(months / 12UL);
+                this->month = static_cast<unsigned short>((months % 12UL) + 1UL);
+                if (this->year > 32767)
+                 {
+                  return(false);
+                 }
+                this->periodJD = julianToJD(this->year, this->month, 1);
+                break;
+               }
+              case Frequency::Yearly :
+                this->year += static_cast<long>(interval);
+                if (this->year > 32767)
+                 {
+                  return(false);
+                 }
+                this->periodJD = julianFirstJD(this->year);
+                break;
+             }
+            return((this->periodJD <= maxJulianJD) && (this->periodJD <= this->recurrence->rule.getUntil()));
+           }
+
+
+          /**
+           * Advance to the next occurrence or to the end.
+           *
+           * The days of the current period are taken from the mask lowest bit first.
+           */
+          void next() noexcept
+           {
+            const RecurrenceRule &rule = this->recurrence->rule;
+            if ((rule.getCount() != 0) && (this->emitted == rule.getCount()))
+             {
+              this->done = true;
+              return;
+             }
+            for (;;)
+             {
+              while (this->word < this->words)
+               {
+                const std::uint64_t bits = this->mask[this->word];
+                if (bits == 0)
+                 {
+                  ++this->word;
+                  continue;
+                 }
+                this->mask[this->word] = bits & (bits - 1U);
+                this->jd = this->periodJD + (this->word * 64UL) + lowestBit(bits);
+                if (this->jd < this->recurrence->startJD)
+                 {
+                  continue;
+                 }
+                if ((this->jd > rule.getUntil()) || (this->jd > maxJulianJD))
+                 {
+                  this->done = true;
+                  return;
+                 }
+                ++this->emitted;
+                return;
+               }
+              if (!nextPeriod())
+               {
+                this->done = true;
+                return;
+               }
+              fillPeriod();
+             }
+           }
+
+
+          const JulianRecurrence *recurrence;
+          DayMask mask {};
+          unsigned long periodJD = 0;
+          unsigned long jd = 0;
+          unsigned long emitted = 0;
+          unsigned long monthLength = 0;
+          long year = 0;
+          unsigned short month = 0;
+          unsigned short word = 0;
+          unsigned short words = 0;
+          bool done;
+
+       };
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] start Start date (DTSTART)
+       * @param[in] rule Recurrence rule
+       */
+      JulianRecurrence(const JulianDate &start, const RecurrenceRule &rule) noexcept
+       : start(start), rule(rule), startJD(start.getJD().getJD()), weekdays(rule.getAllWeekdays()),
+         byDay((rule.getWeekdays() != 0) || (rule.getOrdinalCount() != 0)), byMonthDay((rule.getMonthDays() != 0) || (rule.getLastMonthDays() != 0))
+       {
+        // Without BYMONTHDAY and BYDAY the day of the start date recurs
+        const std::uint32_t monthDays = this->byMonthDay ? rule.getMonthDays() : (std::uint32_t{1} << start.getDay().getDay());
+        for (unsigned long daysInMonth = 28; daysInMonth <= 31; ++daysInMonth)
+         {
+          this->monthDays[daysInMonth - 28U] = Iterator::monthDayBits(daysInMonth, monthDays, this->byMonthDay ? rule.getLastMonthDays() : 0U, rule.getSkip());
+         }
+       }
+
+
+      /**
+       * Iterator to the first occurrence.
+       *
+       * @return Iterator
+       */
+      [[nodiscard]] auto begin() const noexcept -> Iterator
+       {
+        return(Iterator(*this, false));
+       }
+
+
+      /**
+       * Iterator behind the last occurrence.
+       *
+       * @return Iterator
+       */
+      [[nodiscard]] auto end() const noexcept -> Iterator
+       {
+        return(Iterator(*this, true));
+       }
+
+    private:
+      JulianDate start;
+      RecurrenceRule rule;
+      unsigned long startJD;
+      unsigned short weekdays;
+      bool byDay;
+      bool byMonthDay;
+      std::array<std::uint64_t, 4> monthDays {};
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_JULIANRECURRENCE_H_
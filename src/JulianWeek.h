@@ -9,10 +9,13 @@
 
 
 #include <ostream>
+#include <cassert>
 #include <stdexcept>
 #include <string>
 #include "Weeks.h"
 #include "JulianYear.h"
+#include "Expected.h"
+#include "Unchecked.h"
 
 
 /** @namespace de::powerstat::datelib
@@ -59,6 +62,70 @@ namespace de::powerstat::datelib
        }
 
 
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] week Week number (1-53)
+       */
+      constexpr explicit JulianWeek([[maybe_unused]] const Unchecked tag, const unsigned short week) noexcept
+       : week(week), maxWeeks(53UL)
+       {
+        assert(week >= 1 && week <= 53);
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] week Week number (1 - max weeks in year) depending on the year
+       * @param[in] year Year
+       */
+      constexpr explicit JulianWeek([[maybe_unused]] const Unchecked tag, const unsigned short week, const JulianYear year) noexcept
+       : week(week), maxWeeks{year.getWeeksInYear().getWeeks()}
+       {
+        assert(week >= 1 && week <= this->maxWeeks);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] week Week number (1-53)
+       * @return JulianWeek or ValidationError::WeekOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const unsigned short week) noexcept -> Expected<JulianWeek>
+       {
+        if (week < 1 || week > 53)
+         {
+          return(Expected<JulianWeek>(ValidationError::WeekOutOfRange));
+         }
+        return(Expected<JulianWeek>(JulianWeek(unchecked, week)));
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] week Week number (1 - max weeks in year) depending on the year
+       * @param[in] year Year
+       * @return JulianWeek or ValidationError::WeekOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const unsigned short week, const JulianYear year) noexcept -> Expected<JulianWeek>
+       {
+        if (week < 1 || week > year.getWeeksInYear().getWeeks())
+         {
+          return(Expected<JulianWeek>(ValidationError::WeekOutOfRange));
+         }
+        return(Expected<JulianWeek>(JulianWeek(unchecked, week, year)));
+       }
+
+
       /**
        * Copy constructor.
        *
@@ -83,7 +150,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another week object to be assigned to this object.
        */
-      auto operator=(const JulianWeek &other) & noexcept -> JulianWeek& = delete;
+      constexpr auto operator=(const JulianWeek &other) & noexcept -> JulianWeek& = default;
 
       /**
        * Move assignment operator for another Week object.
@@ -91,7 +158,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another week object to be assigned to this object.
        * @return JulianWeek&
        */
-      auto operator=(JulianWeek&& other) & noexcept -> JulianWeek& = delete;
+      constexpr auto operator=(JulianWeek&& other) & noexcept -> JulianWeek& = default;
 
 
       /**
@@ -116,8 +183,8 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const unsigned short week;
-      const unsigned long maxWeeks;
+      unsigned short week;
+      unsigned long maxWeeks;
 
    };
 
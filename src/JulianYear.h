@@ -9,6 +9,7 @@
 
 
 #include <ostream>
+#include <cassert>
 #include <stdexcept>
 #include <climits>
 #include "Days.h"
@@ -16,6 +17,9 @@
 #include "Weeks.h"
 #include "Weekdays.h"
 #include "ScaligerYear.h"
+#include "DayNumber.h"
+#include "Expected.h"
+#include "Unchecked.h"
 
 
 /** @namespace de::powerstat::datelib
@@ -56,6 +60,37 @@ namespace de::powerstat::datelib
        }
 
 
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] year Year number (8-32767)
+       */
+      constexpr explicit JulianYear([[maybe_unused]] const Unchecked tag, const long year) noexcept
+       : year(year)
+       {
+        assert(year >= 8 && year <= 32767);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] year Year number (8-32767)
+       * @return JulianYear or ValidationError::YearOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const long year) noexcept -> Expected<JulianYear>
+       {
+        if (year < 8 || year > 32767)
+         {
+          return(Expected<JulianYear>(ValidationError::YearOutOfRange));
+         }
+        return(Expected<JulianYear>(JulianYear(unchecked, year)));
+       }
+
+
        /**
         * Copy constructor.
         *
@@ -81,7 +116,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another year object to be assigned to this object.
        * @return JulianYear
        */
-      auto operator=(const JulianYear &other) & noexcept -> JulianYear& = delete;
+      constexpr auto operator=(const JulianYear &other) & noexcept -> JulianYear& = default;
 
       /**
        * Move assignment operator for another Year object.
@@ -89,7 +124,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another year object to be assigned to this object.
        * @return JulianYear&
        */
-      auto operator=(JulianYear&& other) & noexcept -> JulianYear& = delete;
+      constexpr auto operator=(JulianYear&& other) & noexcept -> JulianYear& = default;
 
 
       /**
@@ -136,25 +171,7 @@ namespace de::powerstat::datelib
        */
       [[nodiscard]] constexpr auto getWeeksInYear() const noexcept -> Weeks
        {
-        const long year = this->year - 1;
-        const unsigned short decade = static_cast<unsigned short>(year - ((year / 100) * 100));
-        // Formula from Ch. Zeller in 1877 optimized for 01.01.yyyy
-        unsigned short wday = static_cast<unsigned short>((42 + decade + (decade / 4) - static_cast<unsigned short>(year / 100)) % 7);
-        // Convert (1-su 2-mo 3-tu 4-we 5-th 6-fr 7/0-sa) to iso days
-        if (wday == 0)
-         {
-          wday = 6;
-         }
-        else
-         {
-          --wday;
-          if (wday == 0)
-           {
-            wday = 7;
-           }
-         }
-        const Weekdays firstWeekday = Weekdays(wday);
-        return Weeks(((firstWeekday == Weekdays::Thursday) || (isLeapYear() && (firstWeekday == Weekdays::Wednesday))) ? 53 : 52);
+        return(Weeks(julianWeeksInYear(this->year)));
        }
 
 
@@ -170,7 +187,7 @@ namespace de::powerstat::datelib
 
 
     private:
-      const long year;
+      long year;
 
    };
 
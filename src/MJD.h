@@ -76,7 +76,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another MJD object to be assigned to this object.
        */
-      auto operator=(const MJD &other) & -> MJD& = delete;
+      constexpr auto operator=(const MJD &other) & noexcept -> MJD& = default;
 
       /**
        * Move assignment operator for another MJD object.
@@ -84,7 +84,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another MJD object to be assigned to this object.
        * @return MJD&
        */
-      auto operator=(MJD&& other) & noexcept -> MJD& = delete;
+      constexpr auto operator=(MJD&& other) & noexcept -> MJD& = default;
 
       /**
        * Get MJD as primitive data type.
@@ -113,7 +113,7 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const unsigned long mjd;
+      unsigned long mjd;
 
    };
 
@@ -59,7 +59,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another months object to be assigned to this object.
        */
-     auto operator=(const Months &other) & noexcept ->  Months& = delete;
+      constexpr auto operator=(const Months &other) & noexcept -> Months& = default;
 
       /**
        * Move assignment operator for another Months object.
@@ -67,7 +67,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another months object to be assigned to this object.
        * @return Months&
        */
-      auto operator=(Months&& other) & noexcept -> Months& = delete;
+      constexpr auto operator=(Months&& other) & noexcept -> Months& = default;
 
 
       /**
@@ -81,7 +81,7 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const unsigned long months;
+      unsigned long months;
    };
 
 
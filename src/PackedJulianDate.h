@@ -0,0 +1,512 @@
+/** @file
+ * A PackedJulianDate is a representation of a year-month-day within 32 bits.
+ * So it could have a value between 8-01-01 and 32767-12-31
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_PACKEDJULIANDATE_H_
+#define DATELIB_PACKEDJULIANDATE_H_
+
+
+#include <ostream>
+#include <cassert>
+#include <stdexcept>
+#include <cstdint>
+#include "Weekdays.h"
+#include "Days.h"
+#include "Months.h"
+#include "Years.h"
+#include "Weeks.h"
+#include "Duration.h"
+#include "JD.h"
+#include "DayNumber.h"
+#include "JulianDay.h"
+#include "JulianMonth.h"
+#include "JulianYear.h"
+#include "JulianWeek.h"
+#include "JulianDate.h"
+#include "Unchecked.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Value class that represents a date in the julian calendar system packed into 32 bits.
+   *
+   * Bits 9-23 hold the year, bits 5-8 the month and bits 0-4 the day, so the packed values compare like the dates.
+   */
+  class PackedJulianDate final
+   {
+    public:
+      /**
+       * Constructor.
+       *
+       * @param[in] year Year
+       * @param[in] month Month depending on the year
+       * @param[in] day Day depending on the month
+       * @throws std::out_of_range Date is < 8-1-1 or > 32767-12-31
+       */
+      constexpr explicit PackedJulianDate(const JulianYear year, const JulianMonth month, const JulianDay day)
+       : PackedJulianDate(JulianDate(year, month, day))
+       {
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] jd JD
+       * @throws std::out_of_range Date is < 8-1-1 or > 32767-12-31
+       */
+      constexpr explicit PackedJulianDate(const JD jd)
+       : PackedJulianDate(JulianDate(jd))
+       {
+       }
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] date JulianDate to pack
+       */
+      constexpr explicit PackedJulianDate(const JulianDate &date) noexcept
+       : date((static_cast<std::uint32_t>(date.getYear().getYear()) << 9U) | (static_cast<std::uint32_t>(date.getMonth().getMonth()) << 5U) | static_cast<std::uint32_t>(date.getDay().getDay()))
+       {
+       }
+
+
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The packed date is only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] packed Packed date (year << 9 | month << 5 | day)
+       */
+      constexpr explicit PackedJulianDate([[maybe_unused]] const Unchecked tag, const std::uint32_t packed) noexcept
+       : date(packed)
+       {
+        assert(JulianDate::tryMake(static_cast<long>(packed >> 9U), static_cast<unsigned short>((packed >> 5U) & 0x0fU), static_cast<unsigned short>(packed & 0x1fU)).hasValue());
+       }
+
+
+      /**
+       * Copy constructor.
+       *
+       * @param[in] other Another PackedJulianDate object to copy from.
+       */
+      constexpr PackedJulianDate(const PackedJulianDate &other) noexcept = default;
+
+      /**
+       * Move constructor.
+       *
+       * @param[in] other Another PackedJulianDate object to move from.
+       */
+      constexpr PackedJulianDate(PackedJulianDate&& other) noexcept = default;
+
+      /**
+       * Destructor.
+       */
+      ~PackedJulianDate() noexcept = default;
+
+      /**
+       * Assignment operator for another PackedJulianDate object.
+       *
+       * @param[in] other Another PackedJulianDate object to be assigned to this object.
+       */
+      constexpr auto operator=(const PackedJulianDate &other) & noexcept -> PackedJulianDate& = default;
+
+      /**
+       * Move assignment operator for another PackedJulianDate object.
+       *
+       * @param[in] other Another PackedJulianDate object to be assigned to this object.
+       * @return PackedJulianDate&
+       */
+      constexpr auto operator=(PackedJulianDate&& other) & noexcept -> PackedJulianDate& = default;
+
+
+      /**
+       * Get packed date as primitive data type.
+       *
+       * @return Packed date (year << 9 | month << 5 | day)
+       */
+      [[nodiscard]] constexpr auto getPacked() const noexcept -> std::uint32_t
+       {
+        return(this->date);
+       }
+
+
+      /**
+       * Get year as data type.
+       *
+       * @return JulianYear (8-32767)
+       */
+      [[nodiscard]] constexpr auto getYear() const noexcept -> JulianYear
+       {
+        return(JulianYear(unchecked, static_cast<long>(this->date >> 9U)));
+       }
+
+
+      /**
+       * Get month as data type.
+       *
+       * @return JulianMonth (1-12)
+       */
+      [[nodiscard]] constexpr auto getMonth() const noexcept -> JulianMonth
+       {
+        return(JulianMonth(unchecked, getYear(), static_cast<unsigned short>((this->date >> 5U) & 0x0fU)));
+       }
+
+
+      /**
+       * Get day as data type.
+       *
+       * @return JulianDay (1-31)
+       */
+      [[nodiscard]] constexpr auto getDay() const noexcept -> JulianDay
+       {
+        return(JulianDay(unchecked, static_cast<unsigned short>(this->date & 0x1fU)));
+       }
+
+
+      /**
+       * Get the unpacked date.
+       *
+       * @return JulianDate
+       */
+      [[nodiscard]] constexpr auto getJulianDate() const noexcept -> JulianDate
+       {
+        return(JulianDate(unchecked, static_cast<long>(this->date >> 9U), static_cast<unsigned short>((this->date >> 5U) & 0x0fU), static_cast<unsigned short>(this->date & 0x1fU)));
+       }
+
+
+      /**
+       * Get weekday as data type.
+       *
+       * @return Weekday
+       */
+      [[nodiscard]] constexpr auto getWeekday() const -> Weekdays
+       {
+        return(getJulianDate().getWeekday());
+       }
+
+
+      /**
+       * Get the Day within Year
+       *
+       * @return Days (1-366)
+       */
+      [[nodiscard]] constexpr auto getDayWithinYear() const -> Days
+       {
+        return(getJulianDate().getDayWithinYear());
+       }
+
+
+      /**
+       * Get week as data type.
+       *
+       * @return JulianWeek (1-53)
+       */
+      [[nodiscard]] constexpr auto getWeek() const -> JulianWeek
+       {
+        return(getJulianDate().getWeek());
+       }
+
+
+      /**
+       * Get JD as data type.
+       *
+       * @return JD
+       */
+      [[nodiscard]] constexpr auto getJD() const -> JD
+       {
+        return(getJulianDate().getJD());
+       }
+
+    private:
+      std::uint32_t date;
+
+   };
+
+
+  /** @relates PackedJulianDate
+   * Operator equal to compare two PackedJulianDate objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are equal in value.
+   */
+  [[nodiscard]] constexpr auto operator==(const PackedJulianDate &lhs, const PackedJulianDate &rhs) noexcept -> bool
+   {
+    return(lhs.getPacked() == rhs.getPacked());
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator not equal to compare two PackedJulianDate objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs and rhs are not equal in value.
+   */
+  [[nodiscard]] constexpr auto operator!=(const PackedJulianDate &lhs, const PackedJulianDate &rhs) noexcept -> bool
+   {
+    return(!(lhs == rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator smaller to compare two PackedJulianDate objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<(const PackedJulianDate &lhs, const PackedJulianDate &rhs) noexcept -> bool
+   {
+    return(lhs.getPacked() < rhs.getPacked());
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator greater to compare two PackedJulianDate objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>(const PackedJulianDate &lhs, const PackedJulianDate &rhs) noexcept -> bool
+   {
+    return(rhs < lhs);
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator smaller or equal to compare two PackedJulianDate objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is smaller or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator<=(const PackedJulianDate &lhs, const PackedJulianDate &rhs) noexcept -> bool
+   {
+    return(!(lhs > rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator greater or equal to compare two PackedJulianDate objects.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return true when lhs is greater or equal than rhs.
+   */
+  [[nodiscard]] constexpr auto operator>=(const PackedJulianDate &lhs, const PackedJulianDate &rhs) noexcept -> bool
+   {
+    return(!(lhs < rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator plus to add a Years value to a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const PackedJulianDate &lhs, const Years &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() + rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator minus to subtract a Years value from a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const PackedJulianDate &lhs, const Years &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() - rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator plus to add a Months value to a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const PackedJulianDate &lhs, const Months &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() + rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator minus to subtract a Months value from a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const PackedJulianDate &lhs, const Months &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() - rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Day difference when subtract a PackedJulianDate value from a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Days object
+   */
+  [[nodiscard]] constexpr auto dayDiff(const PackedJulianDate &lhs, const PackedJulianDate &rhs) -> Days
+   {
+    return(dayDiff(lhs.getJulianDate(), rhs.getJulianDate()));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator plus to add a Days value to a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   * @throws std::out_of_range When Date will become > 32767-12-31
+   */
+  [[nodiscard]] constexpr auto operator+(const PackedJulianDate &lhs, const Days &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() + rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator minus to subtract a Days value from a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   * @throws std::out_of_range When Date will become < 8-01-01
+   */
+  [[nodiscard]] constexpr auto operator-(const PackedJulianDate &lhs, const Days &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() - rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator plus to add a Weeks value to a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const PackedJulianDate &lhs, const Weeks &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() + rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator minus to subtract a Weeks value from a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const PackedJulianDate &lhs, const Weeks &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() - rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator plus to add a Duration value to a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const PackedJulianDate &lhs, const Duration &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() + rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator minus to subtract a Duration value from a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const PackedJulianDate &lhs, const Duration &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() - rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator plus to move to the next (or same) Weekday PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator+(const PackedJulianDate &lhs, const Weekdays &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() + rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator minus to move to the previous (or same) Weekday PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New PackedJulianDate object
+   */
+  [[nodiscard]] constexpr auto operator-(const PackedJulianDate &lhs, const Weekdays &rhs) -> PackedJulianDate
+   {
+    return(PackedJulianDate(lhs.getJulianDate() - rhs));
+   }
+
+
+  /** @relates PackedJulianDate
+   * Operator minus to subtract a PackedJulianDate value from a PackedJulianDate.
+   *
+   * @param[in] lhs Left hand side object
+   * @param[in] rhs Right hand side object
+   * @return New Duration object
+   */
+  [[nodiscard]] constexpr auto operator-(const PackedJulianDate &lhs, const PackedJulianDate &rhs) -> Duration
+   {
+    return(lhs.getJulianDate() - rhs.getJulianDate());
+   }
+
+
+  /** @relates PackedJulianDate
+   * Stream operator to write a PackedJulianDate to an output stream.
+   *
+   * @param[in] outs Output stream
+   * @param[in] obj PackedJulianDate object to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& outs, const PackedJulianDate& obj) -> std::ostream&
+   {
+    outs << "PackedJulianDate(" << obj.getYear() << ", " << obj.getMonth() << ", " << obj.getDay() << ")";
+    return outs;
+   }
+
+ } // namespace
+
+#endif // DATELIB_PACKEDJULIANDATE_H_
@@ -0,0 +1,413 @@
+/** @file
+ * Recurrence rule in the style of RFC 5545 (FREQ, INTERVAL, BYDAY, BYMONTHDAY, BYSETPOS, COUNT and UNTIL) with the SKIP rule of RFC 7529.
+ * The rule has a fixed size without allocations, so that it could be a constexpr value.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_RECURRENCERULE_H_
+#define DATELIB_RECURRENCERULE_H_
+
+
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include "JD.h"
+#include "Weekdays.h"
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Frequency of a recurrence rule, every period of it contains a set of occurrences.
+   */
+  enum class Frequency : unsigned short
+   {
+    /**
+     * Period of one day.
+     */
+    Daily = 0,
+
+    /**
+     * Period of a week from monday to sunday.
+     */
+    Weekly = 1,
+
+    /**
+     * Period of a month.
+     */
+    Monthly = 2,
+
+    /**
+     * Period of a year.
+     */
+    Yearly = 3
+   };
+
+
+  /**
+   * Handling of month days that do not exist within a month (RFC 7529).
+   */
+  enum class SkipRule : unsigned short
+   {
+    /**
+     * The occurrence is left out.
+     */
+    Omit = 0,
+
+    /**
+     * The occurrence moves back to the last day of the month.
+     */
+    Backward = 1
+   };
+
+
+  /**
+   * Value class that represents a recurrence rule.
+   *
+   * A rule is build from a frequency and the with...() methods, i.e. the last weekday of each month is
+   * RecurrenceRule(Frequency::Monthly).withByDay(Weekdays::Monday)...withByDay(Weekdays::Friday).withBySetPos(-1).
+   */
+  class RecurrenceRule final
+   {
+    public:
+      /**
+       * Maximum number of BYDAY entries with an ordinal.
+       */
+      static constexpr unsigned short maxOrdinals = 16;
+
+      /**
+       * Maximum number of BYSETPOS entries.
+       */
+      static constexpr unsigned short maxSetPositions = 16;
+
+
+      /**
+       * Constructor.
+       *
+       * @param[in] frequency Frequency (FREQ)
+       * @param[in] interval Every interval-th period (INTERVAL)
+       * @throws std::out_of_range When interval is 0
+       */
+      constexpr explicit RecurrenceRule(const Frequency frequency, const unsigned long interval = 1)
+       : frequency(frequency), interval(interval)
+       {
+        if (interval == 0)
+         {
+          throw std::out_of_range("interval is 0");
+         }
+       }
+
+
+      /**
+       * Add a weekday (BYDAY).
+       *
+       * @param[in] weekday Weekday
+       * @param[in] ordinal 0 for all of these weekdays, n for the n-th and -n for the n-th last weekday within the month (monthly) or year (yearly)
+       * @return New RecurrenceRule object
+       * @throws std::out_of_range When ordinal is < -53 or > 53 or there are more than maxOrdinals ordinals
+       */
+      [[nodiscard]] constexpr auto withByDay(const Weekdays weekday, const long ordinal = 0) const -> RecurrenceRule
+       {
+        if ((ordinal < -53) || (ordinal > 53))
+         {
+          throw std::out_of_range("ordinal is < -53 or > 53");
+         }
+        RecurrenceRule result = *this;
+        if (ordinal == 0)
+         {
+          result.weekdays |= static_cast<unsigned short>(1U << static_cast<unsigned short>(weekday));
+          return(result);
+         }
+        if (this->ordinalCount == maxOrdinals)
+         {
+          throw std::out_of_range("more than 16 ordinals");
+         }
+        result.ordinalWeekdays[result.ordinalCount] = weekday;
+        result.ordinals[result.ordinalCount] = static_cast<short>(ordinal);
+        ++result.ordinalCount;
+        return(result);
+       }
+
+
+      /**
+       * Add a day of the month (BYMONTHDAY).
+       *
+       * @param[in] day 1-31 or -1 to -31 for the last to the 31st last day of the month
+       * @return New RecurrenceRule object
+       * @throws std::out_of_range When day is 0 or < -31 or > 31
+       */
+      [[nodiscard]] constexpr auto withByMonthDay(const long day) const -> RecurrenceRule
+       {
+        if ((day == 0) || (day < -31) || (day > 31))
+         {
+          throw std::out_of_range("day is 0 or < -31 or > 31");
+         }
+        RecurrenceRule result = *this;
+        if (day > 0)
+         {
+          result.monthDays |= std::uint32_t{1} << static_cast<unsigned long>(day);
+         }
+        else
+         {
+          result.lastMonthDays |= std::uint32_t{1} << static_cast<unsigned long>(-day);
+         }
+        return(result);
+       }
+
+
+      /**
+       * Add a position within the occurrences of a period (BYSETPOS).
+       *
+       * @param[in] position 1-366 or -1 to -366 for the last to the 366th last occurrence
+       * @return New RecurrenceRule object
+       * @throws std::out_of_range When position is 0 or < -366 or > 366 or there are more than maxSetPositions positions
+       */
+      [[nodiscard]] constexpr auto withBySetPos(const long position) const -> RecurrenceRule
+       {
+        if ((position == 0) || (position < -366) || (position > 366))
+         {
+          throw std::out_of_range("position is 0 or < -366 or > 366");
+         }
+        if (this->setPositionCount == maxSetPositions)
+         {
+          throw std::out_of_range("more than 16 positions");
+         }
+        RecurrenceRule result = *this;
+        result.setPositions[result.setPositionCount] = static_cast<short>(position);
+        ++result.setPositionCount;
+        return(result);
+       }
+
+
+      /**
+       * Limit the number of occurrences (COUNT).
+       *
+       * @param[in] count Number of occurrences
+       * @return New RecurrenceRule object
+       * @throws std::out_of_range When count is 0
+       */
+      [[nodiscard]] constexpr auto withCount(const unsigned long count) const -> RecurrenceRule
+       {
+        if (count == 0)
+         {
+          throw std::out_of_range("count is 0");
+         }
+        RecurrenceRule result = *this;
+        result.count = count;
+        return(result);
+       }
+
+
+      /**
+       * Limit the occurrences to a last day (UNTIL).
+       *
+       * @param[in] until JD of the last possible occurrence (inclusive)
+       * @return New RecurrenceRule object
+       */
+      [[nodiscard]] constexpr auto withUntil(const JD until) const noexcept -> RecurrenceRule
+       {
+        RecurrenceRule result = *this;
+        result.until = until.getJD();
+        return(result);
+       }
+
+
+      /**
+       * Set the handling of month days that do not exist (SKIP).
+       *
+       * @param[in] skip Skip rule
+       * @return New RecurrenceRule object
+       */
+      [[nodiscard]] constexpr auto withSkip(const SkipRule skip) const noexcept -> RecurrenceRule
+       {
+        RecurrenceRule result = *this;
+        result.skip = skip;
+        return(result);
+       }
+
+
+      /**
+       * Get frequency.
+       *
+       * @return Frequency
+       */
+      [[nodiscard]] constexpr auto getFrequency() const noexcept -> Frequency
+       {
+        return(this->frequency);
+       }
+
+
+      /**
+       * Get interval.
+       *
+       * @return Interval (1-ULONG_MAX)
+       */
+      [[nodiscard]] constexpr auto getInterval() const noexcept -> unsigned long
+       {
+        return(this->interval);
+       }
+
+
+      /**
+       * Get the weekdays without ordinal.
+       *
+       * @return Set of weekdays, bit n is set for weekday n (1-7 for monday to sunday)
+       */
+      [[nodiscard]] constexpr auto getWeekdays() const noexcept -> unsigned short
+       {
+        return(this->weekdays);
+       }
+
+
+      /**
+       * Get all weekdays with or without ordinal.
+       *
+       * @return Set of weekdays, bit n is set for weekday n (1-7 for monday to sunday)
+       */
+      [[nodiscard]] constexpr auto getAllWeekdays() const noexcept -> unsigned short
+       {
+        unsigned short result = this->weekdays;
+        for (unsigned short i = 0; i < this->ordinalCount; ++i)
+         {
+          result |= static_cast<unsigned short>(1U << static_cast<unsigned short>(this->ordinalWeekdays[i]));
+         }
+        return(result);
+       }
+
+
+      /**
+       * Get number of weekdays with ordinal.
+       *
+       * @return Number of weekdays with ordinal (0-maxOrdinals)
+       */
+      [[nodiscard]] constexpr auto getOrdinalCount() const noexcept -> unsigned short
+       {
+        return(this->ordinalCount);
+       }
+
+
+      /**
+       * Get weekday with ordinal.
+       *
+       * @param[in] index Index (0-getOrdinalCount()-1)
+       * @return Weekday
+       */
+      [[nodiscard]] constexpr auto getOrdinalWeekday(const unsigned short index) const noexcept -> Weekdays
+       {
+        return(this->ordinalWeekdays[index]);
+       }
+
+
+      /**
+       * Get ordinal of a weekday.
+       *
+       * @param[in] index Index (0-getOrdinalCount()-1)
+       * @return Ordinal (-53 to -1 or 1 to 53)
+       */
+      [[nodiscard]] constexpr auto getOrdinal(const unsigned short index) const noexcept -> long
+       {
+        return(this->ordinals[index]);
+       }
+
+
+      /**
+       * Get the days of the month.
+       *
+       * @return Set of days, bit n is set for day n (1-31)
+       */
+      [[nodiscard]] constexpr auto getMonthDays() const noexcept -> std::uint32_t
+       {
+        return(this->monthDays);
+       }
+
+
+      /**
+       * Get the days of the month that are counted from the end of the month.
+       *
+       * @return Set of days, bit n is set for the n-th last day (1-31)
+       */
+      [[nodiscard]] constexpr auto getLastMonthDays() const noexcept -> std::uint32_t
+       {
+        return(this->lastMonthDays);
+       }
+
+
+      /**
+       * Get number of set positions.
+       *
+       * @return Number of set positions (0-maxSetPositions)
+       */
+      [[nodiscard]] constexpr auto getSetPositionCount() const noexcept -> unsigned short
+       {
+        return(this->setPositionCount);
+       }
+
+
+      /**
+       * Get set position.
+       *
+       * @param[in] index Index (0-getSetPositionCount()-1)
+       * @return Position (-366 to -1 or 1 to 366)
+       */
+      [[nodiscard]] constexpr auto getSetPosition(const unsigned short index) const noexcept -> long
+       {
+        return(this->setPositions[index]);
+       }
+
+
+      /**
+       * Get count.
+       *
+       * @return Maximum number of occurrences, 0 for no limit
+       */
+      [[nodiscard]] constexpr auto getCount() const noexcept -> unsigned long
+       {
+        return(this->count);
+       }
+
+
+      /**
+       * Get until.
+       *
+       * @return JD number of the last possible occurrence, ULONG_MAX for no limit
+       */
+      [[nodiscard]] constexpr auto getUntil() const noexcept -> unsigned long
+       {
+        return(this->until);
+       }
+
+
+      /**
+       * Get skip rule.
+       *
+       * @return Skip rule
+       */
+      [[nodiscard]] constexpr auto getSkip() const noexcept -> SkipRule
+       {
+        return(this->skip);
+       }
+
+    private:
+      Frequency frequency;
+      unsigned long interval;
+      unsigned short weekdays = 0;
+      unsigned short ordinalCount = 0;
+      std::array<Weekdays, maxOrdinals> ordinalWeekdays {};
+      std::array<short, maxOrdinals> ordinals {};
+      std::uint32_t monthDays = 0;
+      std::uint32_t lastMonthDays = 0;
+      unsigned short setPositionCount = 0;
+      std::array<short, maxSetPositions> setPositions {};
+      unsigned long count = 0;
+      unsigned long until = ULONG_MAX;
+      SkipRule skip = SkipRule::Omit;
+
+   };
+
+ } // namespace
+
+#endif // DATELIB_RECURRENCERULE_H_
@@ -9,10 +9,13 @@
 
 
 #include <ostream>
+#include <cassert>
 #include <stdexcept>
 #include <climits>
 #include "Years.h"
 #include "JD.h"
+#include "Expected.h"
+#include "Unchecked.h"
 
 
 /** @namespace de::powerstat::datelib
@@ -54,6 +57,37 @@ namespace de::powerstat::datelib
         }
 
 
+      /**
+       * Constructor for trusted input without validation.
+       *
+       * The arguments are only checked with assertions within debug builds.
+       *
+       * @param[in] tag Unchecked tag
+       * @param[in] year Year number (4707 - 6295)
+       */
+      constexpr explicit ScaligerYear([[maybe_unused]] const Unchecked tag, const long year) noexcept
+       : year(year)
+       {
+        assert(year >= 4707 && year <= 6295);
+       }
+
+
+      /**
+       * Non throwing factory.
+       *
+       * @param[in] year Year number (4707 - 6295)
+       * @return ScaligerYear or ValidationError::YearOutOfRange
+       */
+      [[nodiscard]] static constexpr auto tryMake(const long year) noexcept -> Expected<ScaligerYear>
+       {
+        if (year < 4707 || year > 6295)
+         {
+          return(Expected<ScaligerYear>(ValidationError::YearOutOfRange));
+         }
+        return(Expected<ScaligerYear>(ScaligerYear(unchecked, year)));
+       }
+
+
        /**
         * Copy constructor.
         *
@@ -79,7 +113,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another year object to be assigned to this object.
        * @return ScaligerYear
        */
-      auto operator=(const ScaligerYear &other) & noexcept -> ScaligerYear& = delete;
+      constexpr auto operator=(const ScaligerYear &other) & noexcept -> ScaligerYear& = default;
 
       /**
        * Move assignment operator for another Year object.
@@ -87,7 +121,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another year object to be assigned to this object.
        * @return ScaligerYear&
        */
-      auto operator=(ScaligerYear&& other) & noexcept -> ScaligerYear& = delete;
+      constexpr auto operator=(ScaligerYear&& other) & noexcept -> ScaligerYear& = default;
 
 
       /**
@@ -113,7 +147,7 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const long year;
+      long year;
 
    };
 
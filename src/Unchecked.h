@@ -0,0 +1,37 @@
+/** @file
+ * Tag to select the constructors for trusted input that do not validate their arguments.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_UNCHECKED_H_
+#define DATELIB_UNCHECKED_H_
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Tag type for unchecked construction.
+   *
+   * The arguments are only checked with assertions within debug builds,
+   * so the caller is responsible for valid values (i.e. data that has been validated before).
+   */
+  struct Unchecked final
+   {
+    /**
+     * Constructor.
+     */
+    constexpr explicit Unchecked() noexcept = default;
+   };
+
+
+  /**
+   * Unchecked tag value.
+   */
+  inline constexpr Unchecked unchecked {};
+
+ } // namespace
+
+#endif // DATELIB_UNCHECKED_H_
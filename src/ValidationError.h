@@ -0,0 +1,54 @@
+/** @file
+ * Error codes of the non throwing validation (tryMake) factories.
+ *
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+#ifndef DATELIB_VALIDATIONERROR_H_
+#define DATELIB_VALIDATIONERROR_H_
+
+
+#include <array>
+#include <ostream>
+
+
+/** @namespace de::powerstat::datelib
+ * DateLib namespace was a registered trademark in Germany of Dipl.-Inform. Kai Hofmann from 1998 until 2008.
+ */
+namespace de::powerstat::datelib
+ {
+  /**
+   * Enumeration of validation errors.
+   */
+  enum class ValidationError : unsigned short
+   {
+    None = 0,
+    YearOutOfRange = 1,
+    MonthOutOfRange = 2,
+    DayOutOfRange = 3,
+    WeekOutOfRange = 4,
+    JDOutOfRange = 5
+   };
+
+
+  /**
+   * Validation error names.
+   */
+  constexpr std::array<const char *, 6> validationErrorNames {"None", "YearOutOfRange", "MonthOutOfRange", "DayOutOfRange", "WeekOutOfRange", "JDOutOfRange"};
+
+
+  /** @relates ValidationError
+   * Stream operator to write a ValidationError to an output stream.
+   *
+   * @param[in] os Output stream
+   * @param[in] obj ValidationError enum to write to the output stream
+   * @return Output stream
+   */
+  inline auto operator<<(std::ostream& os, const ValidationError& obj) -> std::ostream&
+   {
+    os << "ValidationError(" << validationErrorNames[static_cast<unsigned short>(obj)] << ")";
+    return os;
+   }
+
+ } // namespace
+
+#endif // DATELIB_VALIDATIONERROR_H_
@@ -59,7 +59,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another weeks object to be assigned to this object.
        */
-      constexpr auto operator=(const Weeks &other) & noexcept -> Weeks& = delete;
+      constexpr auto operator=(const Weeks &other) & noexcept -> Weeks& = default;
 
       /**
        * Move assignment operator for another Weeks object.
@@ -67,7 +67,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another weeks object to be assigned to this object.
        * @return Weeks&
        */
-      constexpr auto operator=(Weeks&& other) & noexcept -> Weeks& = delete;
+      constexpr auto operator=(Weeks&& other) & noexcept -> Weeks& = default;
 
       /**
        * Get number of weeks as primitive data type.
@@ -80,7 +80,7 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const unsigned long weeks;
+      unsigned long weeks;
    };
 
 
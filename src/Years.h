@@ -59,7 +59,7 @@ namespace de::powerstat::datelib
        *
        * @param[in] other Another years object to be assigned to this object.
        */
-      auto operator=(const Years &other) & noexcept -> Years& = delete;
+      constexpr auto operator=(const Years &other) & noexcept -> Years& = default;
 
       /**
        * Move assignment operator for another Years object.
@@ -67,7 +67,7 @@ namespace de::powerstat::datelib
        * @param[in] other Another years object to be assigned to this object.
        * @return Years&
        */
-      auto operator=(Years&& other) & noexcept -> Years& = delete;
+      constexpr auto operator=(Years&& other) & noexcept -> Years& = default;
 
 
       /**
@@ -81,7 +81,7 @@ namespace de::powerstat::datelib
        }
 
     private:
-      const unsigned long years;
+      unsigned long years;
    };
 
 
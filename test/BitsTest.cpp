@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "Bits.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(BitsTest, popcount1)
+   {
+    constexpr unsigned short count = popcount(0);
+    ASSERT_EQ(count, 0);
+   }
+
+
+  TEST(BitsTest, popcount2)
+   {
+    ASSERT_EQ(popcount(~std::uint64_t{0}), 64);
+    ASSERT_EQ(popcount(0x8000000000000001ULL), 2);
+    ASSERT_EQ(popcount(0x00FF00FF00FF00FFULL), 32);
+   }
+
+
+  TEST(BitsTest, packByteFlags1)
+   {
+    ASSERT_EQ(packByteFlags(0), 0);
+    ASSERT_EQ(packByteFlags(0x0101010101010101ULL), 0xFF);
+    ASSERT_EQ(packByteFlags(0x0100000000000001ULL), 0x81);
+    ASSERT_EQ(packByteFlags(0x0001000100010000ULL), 0x54);
+   }
+
+
+  TEST(BitsTest, lowestBit1)
+   {
+    ASSERT_EQ(lowestBit(1), 0);
+    ASSERT_EQ(lowestBit(0x8000000000000000ULL), 63);
+    ASSERT_EQ(lowestBit(0x0000000000F00000ULL), 20);
+   }
+
+
+  TEST(BitsTest, highestBit1)
+   {
+    ASSERT_EQ(highestBit(1), 0);
+    ASSERT_EQ(highestBit(~std::uint64_t{0}), 63);
+    ASSERT_EQ(highestBit(0x0000000000F00001ULL), 23);
+   }
+
+
+  TEST(BitsTest, selectBit1)
+   {
+    ASSERT_EQ(selectBit(1, 0), 0);
+    ASSERT_EQ(selectBit(0x8000000000000001ULL, 1), 63);
+    ASSERT_EQ(selectBit(0x0000010000F00000ULL, 3), 20 + 3);
+    ASSERT_EQ(selectBit(0x0000010000F00000ULL, 4), 40);
+   }
+
+
+  TEST(BitsTest, selectBit2)
+   {
+    const std::uint64_t word = 0x5A5A5A5A5A5A5A5AULL;
+    unsigned short rank = 0;
+    for (unsigned short bit = 0; bit < 64; ++bit)
+     {
+      if (((word >> bit) & 1U) != 0)
+       {
+        ASSERT_EQ(selectBit(word, rank), bit);
+        ++rank;
+       }
+     }
+   }
+
+ }
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "BusinessCalendar.h"
+#include "JulianDate.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * JD from primitive data types of a julian date.
+   *
+   * @param[in] year Year
+   * @param[in] month Month
+   * @param[in] day Day
+   * @return JD
+   */
+  auto jd(const long year, const unsigned short month, const unsigned short day) -> JD
+   {
+    return(JulianDate(JulianYear(year), JulianMonth(month), JulianDay(day)).getJD());
+   }
+
+
+  /**
+   * Calendar for the julian years 2024 and 2025 with new year and christmas as holidays.
+   *
+   * @return BusinessCalendar
+   */
+  auto calendar() -> BusinessCalendar
+   {
+    const std::vector<JD> holidays {jd(2024, 1, 1), jd(2024, 12, 25), jd(2025, 1, 1), jd(2025, 12, 25), jd(2030, 1, 1)};
+    return(BusinessCalendar(jd(2024, 1, 1), jd(2025, 12, 31), holidays.data(), holidays.size()));
+   }
+
+
+  TEST(BusinessCalendarTest, constructor1)
+   {
+    const BusinessCalendar cal = calendar();
+    ASSERT_EQ(cal.getFirst(), jd(2024, 1, 1));
+    ASSERT_EQ(cal.getLast(), jd(2025, 12, 31));
+   }
+
+
+  TEST(BusinessCalendarTest, constructor2)
+   {
+    try
+     {
+      const BusinessCalendar cal {JD(2), JD(1), nullptr, 0};
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"first > last"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(BusinessCalendarTest, constructor3)
+   {
+    try
+     {
+      const BusinessCalendar cal {JD(1), JD(2), nullptr, 0, {Weekdays::Sunday, static_cast<Weekdays>(0)}};
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"weekend is not a set of weekdays"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(BusinessCalendarTest, constructor4)
+   {
+    const BusinessCalendar cal {jd(2024, 1, 1), jd(2024, 1, 31), nullptr, 0, {}};
+    ASSERT_EQ(cal.countBusinessDays(jd(2024, 1, 1), jd(2024, 2, 1)), 31);
+   }
+
+
+  TEST(BusinessCalendarTest, isBusinessDay1)
+   {
+    const BusinessCalendar cal = calendar();
+    ASSERT_FALSE(cal.isBusinessDay(jd(2024, 1, 1)));
+    ASSERT_TRUE(cal.isBusinessDay(jd(2024, 1, 2)));
+    ASSERT_EQ(JulianDate(JulianYear(2024), JulianMonth(1), JulianDay(7)).getWeekday(), Weekdays::Saturday);
+    ASSERT_FALSE(cal.isBusinessDay(jd(2024, 1, 7)));
+    ASSERT_FALSE(cal.isBusinessDay(jd(2024, 1, 8)));
+    ASSERT_TRUE(cal.isBusinessDay(jd(2024, 1, 9)));
+   }
+
+
+  TEST(BusinessCalendarTest, isBusinessDay2)
+   {
+    try
+     {
+      const bool result = calendar().isBusinessDay(jd(2026, 1, 1));
+      FAIL() << "Expected std::out_of_range " << result;
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day is outside of the calendar"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(BusinessCalendarTest, countBusinessDays1)
+   {
+    const BusinessCalendar cal = calendar();
+    ASSERT_EQ(cal.countBusinessDays(jd(2024, 1, 1), jd(2024, 1, 9)), 5);
+    ASSERT_EQ(cal.countBusinessDays(jd(2024, 1, 9), jd(2024, 1, 1)), 5);
+    ASSERT_EQ(cal.countBusinessDays(jd(2024, 1, 2), jd(2024, 1, 2)), 0);
+   }
+
+
+  TEST(BusinessCalendarTest, countBusinessDays2)
+   {
+    const BusinessCalendar cal = calendar();
+    ASSERT_EQ(cal.countBusinessDays(jd(2025, 12, 31), jd(2026, 1, 1)), 1);
+    ASSERT_EQ(cal.countBusinessDays(jd(2026, 1, 1), jd(2025, 12, 30)), 2);
+    ASSERT_EQ(cal.countBusinessDays(jd(2024, 1, 1), jd(2026, 1, 1)), cal.countBusinessDays(jd(2024, 1, 1), jd(2025, 12, 31)) + 1);
+   }
+
+
+  TEST(BusinessCalendarTest, countBusinessDays3)
+   {
+    try
+     {
+      const unsigned long result = calendar().countBusinessDays(jd(2024, 1, 1), jd(2026, 1, 2));
+      FAIL() << "Expected std::out_of_range " << result;
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day is outside of the calendar"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(BusinessCalendarTest, addBusinessDays1)
+   {
+    const BusinessCalendar cal = calendar();
+    ASSERT_EQ(cal.addBusinessDays(jd(2024, 1, 1), 1), jd(2024, 1, 2));
+    ASSERT_EQ(cal.addBusinessDays(jd(2024, 1, 6), 1), jd(2024, 1, 9));
+    ASSERT_EQ(cal.addBusinessDays(jd(2024, 1, 7), 0), jd(2024, 1, 7));
+    ASSERT_EQ(cal.addBusinessDays(jd(2024, 12, 24), 1), jd(2024, 12, 26));
+    ASSERT_EQ(cal.addBusinessDays(jd(2024, 12, 31), 1), jd(2025, 1, 2));
+   }
+
+
+  TEST(BusinessCalendarTest, addBusinessDays2)
+   {
+    try
+     {
+      const JD result = calendar().addBusinessDays(jd(2025, 12, 30), 2);
+      FAIL() << "Expected std::out_of_range " << result;
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"result is outside of the calendar"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(BusinessCalendarTest, subtractBusinessDays1)
+   {
+    const BusinessCalendar cal = calendar();
+    ASSERT_EQ(cal.subtractBusinessDays(jd(2024, 1, 9), 1), jd(2024, 1, 6));
+    ASSERT_EQ(cal.subtractBusinessDays(jd(2024, 12, 26), 1), jd(2024, 12, 24));
+    ASSERT_EQ(cal.subtractBusinessDays(jd(2025, 1, 2), 1), jd(2024, 12, 31));
+   }
+
+
+  TEST(BusinessCalendarTest, subtractBusinessDays2)
+   {
+    try
+     {
+      const JD result = calendar().subtractBusinessDays(jd(2024, 1, 2), 1);
+      FAIL() << "Expected std::out_of_range " << result;
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"result is outside of the calendar"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(BusinessCalendarTest, bruteForce1)
+   {
+    // Friday and saturday weekend with a holiday on every 13th day against a day by day walk
+    std::vector<JD> holidays;
+    for (unsigned long day = 2460000; day < 2461000; day += 13)
+     {
+      holidays.emplace_back(day);
+     }
+    const BusinessCalendar cal {JD(2460000), JD(2460999), holidays.data(), holidays.size(), {Weekdays::Friday, Weekdays::Saturday}};
+    std::vector<unsigned long> businessDays;
+    for (unsigned long day = 2460000; day <= 2460999; ++day)
+     {
+      const Weekdays weekday = JD(day).getWeekday();
+      const bool business = ((day - 2460000) % 13 != 0) && (weekday != Weekdays::Friday) && (weekday != Weekdays::Saturday);
+      ASSERT_EQ(cal.isBusinessDay(JD(day)), business);
+      if (business)
+       {
+        businessDays.push_back(day);
+       }
+     }
+    ASSERT_EQ(cal.countBusinessDays(JD(2460000), JD(2461000)), businessDays.size());
+    for (std::size_t i = 0; i < businessDays.size(); ++i)
+     {
+      ASSERT_EQ(cal.addBusinessDays(JD(2460000), i + 1), JD(businessDays[i]));
+      ASSERT_EQ(cal.subtractBusinessDays(JD(2460999), businessDays.size() - i - (cal.isBusinessDay(JD(2460999)) ? 1 : 0)), JD(businessDays[i]));
+     }
+   }
+
+ }
@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include "DateBatch.h"
+#include "JulianDate.h"
+#include "GregorianDate.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(DateBatchTest, validityMaskWords)
+   {
+    ASSERT_EQ(validityMaskWords(0), 0);
+    ASSERT_EQ(validityMaskWords(1), 1);
+    ASSERT_EQ(validityMaskWords(64), 1);
+    ASSERT_EQ(validityMaskWords(65), 2);
+   }
+
+
+  TEST(DateBatchTest, validateJulianJDs)
+   {
+    const std::vector<unsigned long> jds {minJulianJD - 1, minJulianJD, maxJulianJD, maxJulianJD + 1, 0};
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    ASSERT_EQ(validateJulianJDs(jds.data(), jds.size(), valid.data()), 2);
+    ASSERT_EQ(valid[0], 0b00110U);
+   }
+
+
+  TEST(DateBatchTest, decodeJulianDates1)
+   {
+    const std::vector<unsigned long> jds {1723980, 2299160, 1725500, 13689569};
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    ASSERT_EQ(decodeJulianDates(jds.data(), jds.size(), years.data(), months.data(), days.data(), valid.data()), 4);
+    ASSERT_EQ(valid[0], 0b1111U);
+    ASSERT_EQ(years, (std::vector<long>{8, 1582, 12, 32767}));
+    ASSERT_EQ(months, (std::vector<unsigned short>{1, 10, 2, 12}));
+    ASSERT_EQ(days, (std::vector<unsigned short>{1, 4, 29, 31}));
+   }
+
+
+  TEST(DateBatchTest, decodeJulianDates2)
+   {
+    const std::vector<unsigned long> jds {1723979, 2299160, 13689570};
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    ASSERT_EQ(decodeJulianDates(jds.data(), jds.size(), years.data(), months.data(), days.data(), nullptr), 1);
+    ASSERT_EQ(years, (std::vector<long>{0, 1582, 0}));
+    ASSERT_EQ(months, (std::vector<unsigned short>{0, 10, 0}));
+    ASSERT_EQ(days, (std::vector<unsigned short>{0, 4, 0}));
+   }
+
+
+  TEST(DateBatchTest, decodeJulianDates3)
+   {
+    std::vector<unsigned long> jds;
+    for (unsigned long jd = minJulianJD; jd <= maxJulianJD; jd += 97)
+     {
+      jds.push_back(jd);
+     }
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    ASSERT_EQ(decodeJulianDates(jds.data(), jds.size(), years.data(), months.data(), days.data(), valid.data()), jds.size());
+    for (std::size_t i = 0; i < jds.size(); ++i)
+     {
+      const JulianDate date {JD(jds[i])};
+      ASSERT_EQ(years[i], date.getYear().getYear());
+      ASSERT_EQ(months[i], date.getMonth().getMonth());
+      ASSERT_EQ(days[i], date.getDay().getDay());
+      ASSERT_TRUE((valid[i / 64] >> (i % 64)) & 1U);
+     }
+   }
+
+
+  TEST(DateBatchTest, encodeJulianDates1)
+   {
+    const std::vector<long> years {8, 1582, 12, 32767};
+    const std::vector<unsigned short> months {1, 10, 2, 12};
+    const std::vector<unsigned short> days {1, 4, 29, 31};
+    std::vector<unsigned long> jds(years.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(years.size()));
+    ASSERT_EQ(encodeJulianDates(years.data(), months.data(), days.data(), years.size(), jds.data(), valid.data()), 4);
+    ASSERT_EQ(valid[0], 0b1111U);
+    ASSERT_EQ(jds, (std::vector<unsigned long>{1723980, 2299160, 1725500, 13689569}));
+   }
+
+
+  TEST(DateBatchTest, encodeJulianDates2)
+   {
+    const std::vector<long> years {7, 32768, -4, 13, 12, 12, 12, 12, 1582};
+    const std::vector<unsigned short> months {1, 1, 1, 2, 0, 13, 4, 1, 10};
+    const std::vector<unsigned short> days {1, 1, 1, 29, 1, 1, 31, 0, 4};
+    std::vector<unsigned long> jds(years.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(years.size()));
+    ASSERT_EQ(encodeJulianDates(years.data(), months.data(), days.data(), years.size(), jds.data(), valid.data()), 1);
+    ASSERT_EQ(valid[0], 0b100000000U);
+    ASSERT_EQ(jds, (std::vector<unsigned long>{0, 0, 0, 0, 0, 0, 0, 0, 2299160}));
+   }
+
+
+  TEST(DateBatchTest, encodeJulianDates3)
+   {
+    std::vector<long> years;
+    std::vector<unsigned short> months;
+    std::vector<unsigned short> days;
+    for (long year = 8; year <= 32767; year += 13)
+     {
+      for (unsigned short month = 1; month <= 12; ++month)
+       {
+        years.push_back(year);
+        months.push_back(month);
+        days.push_back(static_cast<unsigned short>(1 + ((year + month) % 28)));
+       }
+     }
+    std::vector<unsigned long> jds(years.size());
+    ASSERT_EQ(encodeJulianDates(years.data(), months.data(), days.data(), years.size(), jds.data(), nullptr), years.size());
+    for (std::size_t i = 0; i < years.size(); ++i)
+     {
+      ASSERT_EQ(jds[i], julianToJD(years[i], months[i], days[i]));
+     }
+   }
+
+
+  TEST(DateBatchTest, encodeJulianDates4)
+   {
+    // Years that are only valid within their lower 32 bits and a mask over more than one word
+    std::vector<long> years {4294969296L, -4294965296L};
+    for (long year = 2000; year < 2130; ++year)
+     {
+      years.push_back(((year % 3) == 0) ? -year : year);
+     }
+    const std::vector<unsigned short> months(years.size(), 3);
+    const std::vector<unsigned short> days(years.size(), 1);
+    std::vector<unsigned long> jds(years.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(years.size()));
+    ASSERT_EQ(encodeJulianDates(years.data(), months.data(), days.data(), years.size(), jds.data(), valid.data()), 87);
+    for (std::size_t i = 0; i < years.size(); ++i)
+     {
+      const bool ok = (years[i] > 0) && (years[i] < 32768);
+      ASSERT_EQ(((valid[i / 64] >> (i % 64)) & 1U) != 0, ok);
+      ASSERT_EQ(jds[i], ok ? julianToJD(years[i], 3, 1) : 0);
+     }
+   }
+
+
+  TEST(DateBatchTest, decodeGregorianDates1)
+   {
+    const std::vector<unsigned long> jds {1721425, 1721426, 2299161, 2451604, 13689325, 13689326, 4294967296UL + 2451604UL};
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(jds.size()));
+    ASSERT_EQ(decodeGregorianDates(jds.data(), jds.size(), years.data(), months.data(), days.data(), valid.data()), 4);
+    ASSERT_EQ(valid[0], 0b0011110U);
+    ASSERT_EQ(years, (std::vector<long>{0, 1, 1582, 2000, 32767, 0, 0}));
+    ASSERT_EQ(months, (std::vector<unsigned short>{0, 1, 10, 2, 12, 0, 0}));
+    ASSERT_EQ(days, (std::vector<unsigned short>{0, 1, 15, 29, 31, 0, 0}));
+   }
+
+
+  TEST(DateBatchTest, decodeGregorianDates2)
+   {
+    std::vector<unsigned long> jds;
+    for (unsigned long jd = minGregorianJD; jd <= maxGregorianJD; jd += 97)
+     {
+      jds.push_back(jd);
+     }
+    std::vector<long> years(jds.size());
+    std::vector<unsigned short> months(jds.size());
+    std::vector<unsigned short> days(jds.size());
+    ASSERT_EQ(decodeGregorianDates(jds.data(), jds.size(), years.data(), months.data(), days.data(), nullptr), jds.size());
+    for (std::size_t i = 0; i < jds.size(); ++i)
+     {
+      const GregorianDate date {JD(jds[i])};
+      ASSERT_EQ(years[i], date.getYear().getYear());
+      ASSERT_EQ(months[i], date.getMonth().getMonth());
+      ASSERT_EQ(days[i], date.getDay().getDay());
+     }
+   }
+
+
+  TEST(DateBatchTest, encodeGregorianDates1)
+   {
+    const std::vector<long> years {0, 1, 1900, 2000, 1582, 32767, 32768};
+    const std::vector<unsigned short> months {12, 1, 2, 2, 10, 12, 1};
+    const std::vector<unsigned short> days {31, 1, 29, 29, 15, 31, 1};
+    std::vector<unsigned long> jds(years.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(years.size()));
+    ASSERT_EQ(encodeGregorianDates(years.data(), months.data(), days.data(), years.size(), jds.data(), valid.data()), 4);
+    ASSERT_EQ(valid[0], 0b0111010U);
+    ASSERT_EQ(jds, (std::vector<unsigned long>{0, 1721426, 0, 2451604, 2299161, 13689325, 0}));
+   }
+
+
+  TEST(DateBatchTest, encodeGregorianDates2)
+   {
+    std::vector<long> years;
+    std::vector<unsigned short> months;
+    std::vector<unsigned short> days;
+    for (long year = 1; year <= 32767; year += 13)
+     {
+      for (unsigned short month = 1; month <= 12; ++month)
+       {
+        years.push_back(year);
+        months.push_back(month);
+        days.push_back(static_cast<unsigned short>(1 + ((year + month) % 28)));
+       }
+     }
+    std::vector<unsigned long> jds(years.size());
+    ASSERT_EQ(encodeGregorianDates(years.data(), months.data(), days.data(), years.size(), jds.data(), nullptr), years.size());
+    for (std::size_t i = 0; i < years.size(); ++i)
+     {
+      ASSERT_EQ(jds[i], gregorianToJD(years[i], months[i], days[i]));
+     }
+   }
+
+
+  TEST(DateBatchTest, julianToGregorianDates1)
+   {
+    const std::vector<long> julianYears {1582, 8, 13, 32767};
+    const std::vector<unsigned short> julianMonths {10, 1, 2, 12};
+    const std::vector<unsigned short> julianDays {5, 1, 29, 31};
+    std::vector<long> years(julianYears.size());
+    std::vector<unsigned short> months(julianYears.size());
+    std::vector<unsigned short> days(julianYears.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(julianYears.size()));
+    ASSERT_EQ(julianToGregorianDates(julianYears.data(), julianMonths.data(), julianDays.data(), julianYears.size(), years.data(), months.data(), days.data(), valid.data()), 2);
+    ASSERT_EQ(valid[0], 0b0011U);
+    ASSERT_EQ(years, (std::vector<long>{1582, 7, 0, 0}));
+    ASSERT_EQ(months, (std::vector<unsigned short>{10, 12, 0, 0}));
+    ASSERT_EQ(days, (std::vector<unsigned short>{15, 30, 0, 0}));
+   }
+
+
+  TEST(DateBatchTest, julianToGregorianDates2)
+   {
+    std::vector<long> years;
+    std::vector<unsigned short> months;
+    std::vector<unsigned short> days;
+    for (unsigned long jd = minJulianJD; jd <= maxGregorianJD; jd += 89)
+     {
+      const JulianDate date {JD(jd)};
+      years.push_back(date.getYear().getYear());
+      months.push_back(date.getMonth().getMonth());
+      days.push_back(date.getDay().getDay());
+     }
+    const std::vector<long> julianYears {years};
+    ASSERT_EQ(julianToGregorianDates(years.data(), months.data(), days.data(), years.size(), years.data(), months.data(), days.data(), nullptr), years.size());
+    for (std::size_t i = 0; i < years.size(); ++i)
+     {
+      const GregorianDate date {JD(minJulianJD + (i * 89))};
+      ASSERT_EQ(years[i], date.getYear().getYear());
+      ASSERT_EQ(months[i], date.getMonth().getMonth());
+      ASSERT_EQ(days[i], date.getDay().getDay());
+     }
+    std::vector<std::uint64_t> valid(validityMaskWords(years.size()));
+    ASSERT_EQ(gregorianToJulianDates(years.data(), months.data(), days.data(), years.size(), years.data(), months.data(), days.data(), valid.data()), years.size());
+    for (std::size_t i = 0; i < years.size(); ++i)
+     {
+      ASSERT_EQ(years[i], julianYears[i]);
+      ASSERT_TRUE((valid[i / 64] >> (i % 64)) & 1U);
+     }
+   }
+
+
+  TEST(DateBatchTest, gregorianToJulianDates1)
+   {
+    const std::vector<long> gregorianYears {1582, 8, 7, 1900, 32767};
+    const std::vector<unsigned short> gregorianMonths {10, 1, 12, 2, 12};
+    const std::vector<unsigned short> gregorianDays {15, 1, 29, 29, 31};
+    std::vector<long> years(gregorianYears.size());
+    std::vector<unsigned short> months(gregorianYears.size());
+    std::vector<unsigned short> days(gregorianYears.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(gregorianYears.size()));
+    ASSERT_EQ(gregorianToJulianDates(gregorianYears.data(), gregorianMonths.data(), gregorianDays.data(), gregorianYears.size(), years.data(), months.data(), days.data(), valid.data()), 3);
+    ASSERT_EQ(valid[0], 0b10011U);
+    ASSERT_EQ(years, (std::vector<long>{1582, 8, 0, 0, 32767}));
+    ASSERT_EQ(months, (std::vector<unsigned short>{10, 1, 0, 0, 5}));
+    ASSERT_EQ(days, (std::vector<unsigned short>{5, 3, 0, 0, 1}));
+   }
+
+
+  TEST(DateBatchTest, gregorianToJulianDates2)
+   {
+    // Years that are only valid within their lower 32 bits and the leap days of century years
+    const std::vector<long> gregorianYears {4294969296L, 1600, 1700, 2000, 2100};
+    const std::vector<unsigned short> gregorianMonths {1, 2, 2, 2, 2};
+    const std::vector<unsigned short> gregorianDays {1, 29, 29, 29, 29};
+    std::vector<long> years(gregorianYears.size());
+    std::vector<unsigned short> months(gregorianYears.size());
+    std::vector<unsigned short> days(gregorianYears.size());
+    std::vector<std::uint64_t> valid(validityMaskWords(gregorianYears.size()));
+    ASSERT_EQ(gregorianToJulianDates(gregorianYears.data(), gregorianMonths.data(), gregorianDays.data(), gregorianYears.size(), years.data(), months.data(), days.data(), valid.data()), 2);
+    ASSERT_EQ(valid[0], 0b01010U);
+    ASSERT_EQ(years, (std::vector<long>{0, 1600, 0, 2000, 0}));
+    ASSERT_EQ(months, (std::vector<unsigned short>{0, 2, 0, 2, 0}));
+    ASSERT_EQ(days, (std::vector<unsigned short>{0, 19, 0, 16, 0}));
+   }
+
+
+
+  TEST(DateBatchTest, decodeWeekdays1)
+   {
+    std::vector<unsigned long> jds;
+    for (unsigned long jd = minJulianJD; jd < minJulianJD + 100; ++jd)
+     {
+      jds.push_back(jd);
+     }
+    jds.push_back(maxJulianJD);
+    std::vector<unsigned short> weekdays(jds.size());
+    decodeWeekdays(jds.data(), jds.size(), weekdays.data());
+    for (std::size_t i = 0; i < jds.size(); ++i)
+     {
+      ASSERT_EQ(static_cast<Weekdays>(weekdays[i]), JulianDate(JD(jds[i])).getWeekday());
+     }
+   }
+
+
+  TEST(DateBatchTest, selectWeekdays1)
+   {
+    std::vector<unsigned long> jds;
+    for (unsigned long jd = JulianDate(JulianYear(2024), JulianMonth(1), JulianDay(1)).getJD().getJD(); jds.size() < 70; ++jd)
+     {
+      jds.push_back(jd);
+     }
+    std::vector<std::uint64_t> selected(validityMaskWords(jds.size()));
+    ASSERT_EQ(selectWeekdays(jds.data(), jds.size(), (1U << 6U) | (1U << 7U), selected.data()), 20);
+    for (std::size_t i = 0; i < jds.size(); ++i)
+     {
+      const Weekdays weekday = JD(jds[i]).getWeekday();
+      ASSERT_EQ(((selected[i / 64] >> (i % 64)) & 1U) != 0, (weekday == Weekdays::Saturday) || (weekday == Weekdays::Sunday));
+     }
+   }
+
+
+  TEST(DateBatchTest, selectWeekdays2)
+   {
+    const std::vector<unsigned long> jds {minJulianJD, minJulianJD + 1};
+    std::vector<std::uint64_t> selected(validityMaskWords(jds.size()));
+    ASSERT_EQ(selectWeekdays(jds.data(), jds.size(), 0, selected.data()), 0);
+    ASSERT_EQ(selected[0], 0U);
+   }
+
+ }
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "DateFormatter.h"
+#include "DateParser.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(DateFormatterTest, toCharsJulianDate1)
+   {
+    char buffer[16] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(8), JulianMonth(1), JulianDay(1)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "0008-01-01");
+   }
+
+
+  TEST(DateFormatterTest, toCharsJulianDate2)
+   {
+    char buffer[16] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(32767), JulianMonth(12), JulianDay(31)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "32767-12-31");
+   }
+
+
+  TEST(DateFormatterTest, toCharsJulianDate3)
+   {
+    char buffer[9] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(1582), JulianMonth(10), JulianDay(4)));
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(result.ptr, buffer + sizeof(buffer));
+    ASSERT_EQ(std::string(buffer, sizeof(buffer)), std::string(sizeof(buffer), '\0'));
+   }
+
+
+  TEST(DateFormatterTest, toCharsJulianDate4)
+   {
+    char buffer[10] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(32767), JulianMonth(12), JulianDay(31)));
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(std::string(buffer, sizeof(buffer)), std::string(sizeof(buffer), '\0'));
+   }
+
+
+  TEST(DateFormatterTest, toCharsOrdinal1)
+   {
+    char buffer[16] = {};
+    const std::to_chars_result result = toCharsOrdinal(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(12), JulianMonth(12), JulianDay(31)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "0012-366");
+   }
+
+
+  TEST(DateFormatterTest, toCharsOrdinal2)
+   {
+    char buffer[7] = {};
+    const std::to_chars_result result = toCharsOrdinal(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(1582), JulianMonth(10), JulianDay(4)));
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(std::string(buffer, sizeof(buffer)), std::string(sizeof(buffer), '\0'));
+   }
+
+
+  TEST(DateFormatterTest, toCharsWeek1)
+   {
+    char buffer[16] = {};
+    const std::to_chars_result result = toCharsWeek(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(8), JulianMonth(1), JulianDay(2)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "0008-W01-1");
+   }
+
+
+  TEST(DateFormatterTest, toCharsWeek2)
+   {
+    char buffer[16] = {};
+    const std::to_chars_result result = toCharsWeek(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(8), JulianMonth(12), JulianDay(31)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "0009-W01-1");
+   }
+
+
+  TEST(DateFormatterTest, toCharsWeek3)
+   {
+    char buffer[16] = {};
+    for (unsigned long jd = minJulianJD; jd <= maxJulianJD; jd += 11)
+     {
+      const JulianDate date {JD(jd)};
+      const std::to_chars_result result = toCharsWeek(buffer, buffer + sizeof(buffer), date);
+      ASSERT_EQ(result.ec, std::errc{});
+      unsigned long parsed = 0;
+      ASSERT_EQ(parseJulianJD(buffer, result.ptr, parsed).ec, std::errc{});
+      ASSERT_EQ(parsed, jd);
+     }
+   }
+
+
+  TEST(DateFormatterTest, toCharsWeek4)
+   {
+    // 8-01-01 is a sunday within the last week of the week based year 7
+    char buffer[16] = {};
+    const std::to_chars_result result = toCharsWeek(buffer, buffer + sizeof(buffer), JulianDate(JD(minJulianJD)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "0007-W52-7");
+    unsigned long parsed = 0;
+    ASSERT_EQ(parseJulianJD(buffer, result.ptr, parsed).ec, std::errc{});
+    ASSERT_EQ(parsed, minJulianJD);
+   }
+
+
+  TEST(DateFormatterTest, toCharsWeek5)
+   {
+    char buffer[9] = {};
+    const std::to_chars_result result = toCharsWeek(buffer, buffer + sizeof(buffer), JulianDate(JulianYear(1582), JulianMonth(10), JulianDay(4)));
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(std::string(buffer, sizeof(buffer)), std::string(sizeof(buffer), '\0'));
+   }
+
+
+  TEST(DateFormatterTest, toCharsJD)
+   {
+    char buffer[16] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), JD(2299160));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "2299160");
+   }
+
+
+  TEST(DateFormatterTest, toCharsMJD)
+   {
+    char buffer[16] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), MJD(58000));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "58000");
+   }
+
+
+  TEST(DateFormatterTest, toCharsDuration1)
+   {
+    char buffer[32] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), Duration(Years(1), Months(2), Days(3)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "P1Y2M3D");
+   }
+
+
+  TEST(DateFormatterTest, toCharsDuration2)
+   {
+    char buffer[32] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), Duration(Years(0), Months(0), Days(0)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "P0D");
+   }
+
+
+  TEST(DateFormatterTest, toCharsDuration3)
+   {
+    char buffer[32] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), Duration(Years(32759), Months(11), Days(0)));
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "P32759Y11M");
+   }
+
+
+  TEST(DateFormatterTest, toCharsDuration4)
+   {
+    char buffer[4] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), Duration(Years(1), Months(2), Days(3)));
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+   }
+
+
+  TEST(DateFormatterTest, toCharsBatch1)
+   {
+    const std::vector<JulianDate> dates {JulianDate(JulianYear(8), JulianMonth(1), JulianDay(1)), JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29)), JulianDate(JulianYear(32767), JulianMonth(12), JulianDay(31))};
+    char buffer[64] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), dates.data(), dates.size(), '\n');
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(std::string(buffer, result.ptr), "0008-01-01\n0012-02-29\n32767-12-31\n");
+   }
+
+
+  TEST(DateFormatterTest, toCharsBatch2)
+   {
+    const std::vector<JulianDate> dates {JulianDate(JulianYear(8), JulianMonth(1), JulianDay(1)), JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29))};
+    char buffer[16] = {};
+    const std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), dates.data(), dates.size(), '\n');
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(std::string(buffer, result.ptr), "0008-01-01\n");
+   }
+
+ }
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "DateIntervalIndex.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Pseudo random intervals.
+   *
+   * @param[in] count Number of intervals
+   * @param[in] days Range of the first days
+   * @param[in] length Maximum length - 1
+   * @return Intervals
+   */
+  auto random(const std::size_t count, const unsigned long days, const unsigned long length) -> std::vector<DateInterval>
+   {
+    unsigned long seed = 42;
+    std::vector<DateInterval> result;
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      seed = (seed * 6364136223846793005UL) + 1442695040888963407UL;
+      const unsigned long first = 2400000 + ((seed >> 33U) % days);
+      result.emplace_back(JD(first), JD(first + ((seed >> 13U) % (length + 1))));
+     }
+    return(result);
+   }
+
+
+  /**
+   * Positions of the overlapping intervals by a linear scan.
+   *
+   * @param[in] intervals Intervals
+   * @param[in] range Range
+   * @return Sorted positions
+   */
+  auto scan(const std::vector<DateInterval> &intervals, const DateInterval &range) -> std::vector<std::uint32_t>
+   {
+    std::vector<std::uint32_t> result;
+    for (std::size_t i = 0; i < intervals.size(); ++i)
+     {
+      if (intervals[i].overlaps(range))
+       {
+        result.push_back(static_cast<std::uint32_t>(i));
+       }
+     }
+    return(result);
+   }
+
+
+  /**
+   * Sorted copy.
+   *
+   * @param[in] values Values
+   * @return Sorted values
+   */
+  auto sorted(std::vector<std::uint32_t> values) -> std::vector<std::uint32_t>
+   {
+    std::sort(values.begin(), values.end());
+    return(values);
+   }
+
+
+  TEST(DateIntervalIndexTest, constructor1)
+   {
+    const DateIntervalIndex index {nullptr, 0};
+    ASSERT_EQ(index.size(), 0);
+    std::vector<std::uint32_t> result;
+    index.findStabbing(JD(1), result);
+    ASSERT_TRUE(result.empty());
+   }
+
+
+  TEST(DateIntervalIndexTest, findStabbing1)
+   {
+    const std::vector<DateInterval> intervals {DateInterval(JD(10), JD(20)), DateInterval(JD(1), JD(5)), DateInterval(JD(15), JD(15)), DateInterval(JD(5), JD(30))};
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    ASSERT_EQ(index.size(), 4);
+    std::vector<std::uint32_t> result;
+    index.findStabbing(JD(15), result);
+    ASSERT_EQ(result, (std::vector<std::uint32_t>{3, 0, 2}));
+    result.clear();
+    index.findStabbing(JD(5), result);
+    ASSERT_EQ(result, (std::vector<std::uint32_t>{1, 3}));
+    result.clear();
+    index.findStabbing(JD(31), result);
+    ASSERT_TRUE(result.empty());
+   }
+
+
+  TEST(DateIntervalIndexTest, findOverlaps1)
+   {
+    const std::vector<DateInterval> intervals {DateInterval(JD(10), JD(20)), DateInterval(JD(1), JD(5)), DateInterval(JD(15), JD(15)), DateInterval(JD(5), JD(30))};
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    std::vector<std::uint32_t> result;
+    index.findOverlaps(DateInterval(JD(6), JD(14)), result);
+    ASSERT_EQ(result, (std::vector<std::uint32_t>{3, 0}));
+   }
+
+
+  TEST(DateIntervalIndexTest, bruteForce1)
+   {
+    // Sizes around powers of two, where the tree has missing nodes
+    for (const std::size_t count : {1UL, 2UL, 3UL, 15UL, 16UL, 17UL, 100UL, 1000UL, 4097UL})
+     {
+      const std::vector<DateInterval> intervals = random(count, 2000, 100);
+      const DateIntervalIndex index {intervals.data(), intervals.size()};
+      for (unsigned long day = 2399990; day < 2402110; day += 7)
+       {
+        std::vector<std::uint32_t> result;
+        index.findStabbing(JD(day), result);
+        ASSERT_EQ(sorted(result), scan(intervals, DateInterval(JD(day), JD(day))));
+        result.clear();
+        index.findOverlaps(DateInterval(JD(day), JD(day + 30)), result);
+        ASSERT_EQ(sorted(result), scan(intervals, DateInterval(JD(day), JD(day + 30))));
+       }
+     }
+   }
+
+
+  TEST(DateIntervalIndexTest, bruteForce2)
+   {
+    // A few very long intervals among many short ones
+    std::vector<DateInterval> intervals = random(3000, 10000, 5);
+    intervals.emplace_back(JD(2400000), JD(2410000));
+    intervals.emplace_back(JD(2405000), JD(2405000 + 100000));
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    for (unsigned long day = 2400000; day < 2410010; day += 13)
+     {
+      std::vector<std::uint32_t> result;
+      index.findStabbing(JD(day), result);
+      ASSERT_EQ(sorted(result), scan(intervals, DateInterval(JD(day), JD(day))));
+     }
+   }
+
+
+  TEST(DateIntervalIndexTest, findStabbingBatch1)
+   {
+    // Dense and sparse probes, so that both the sweep and the tree query are used
+    const std::vector<DateInterval> intervals = random(5000, 5000, 50);
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    std::vector<JD> days;
+    for (unsigned long day = 2399990; day < 2402000; ++day)
+     {
+      days.emplace_back(day);
+     }
+    for (unsigned long day = 2402000; day < 2405100; day += 500)
+     {
+      days.emplace_back(day);
+      days.emplace_back(day);
+     }
+    std::vector<std::uint32_t> result;
+    std::vector<std::size_t> offsets(days.size() + 1);
+    index.findStabbing(days.data(), days.size(), result, offsets.data());
+    ASSERT_EQ(offsets.back(), result.size());
+    for (std::size_t i = 0; i < days.size(); ++i)
+     {
+      std::vector<std::uint32_t> single;
+      index.findStabbing(days[i], single);
+      ASSERT_EQ(std::vector<std::uint32_t>(result.begin() + static_cast<std::ptrdiff_t>(offsets[i]), result.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1])), single);
+     }
+   }
+
+
+  TEST(DateIntervalIndexTest, findStabbingBatch2)
+   {
+    const std::vector<DateInterval> intervals {DateInterval(JD(10), JD(20))};
+    const DateIntervalIndex index {intervals.data(), intervals.size()};
+    const std::vector<JD> days {JD(2), JD(1)};
+    std::vector<std::uint32_t> result;
+    std::vector<std::size_t> offsets(days.size() + 1);
+    try
+     {
+      index.findStabbing(days.data(), days.size(), result, offsets.data());
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"days are not sorted"}.compare(e.what()), 0);
+     }
+   }
+
+ }
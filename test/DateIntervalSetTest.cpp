@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <bitset>
+#include <sstream>
+#include <vector>
+#include "DateIntervalSet.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Set from intervals.
+   *
+   * @param[in] intervals Intervals
+   * @return DateIntervalSet
+   */
+  auto set(const std::vector<DateInterval> &intervals) -> DateIntervalSet
+   {
+    return(DateIntervalSet(intervals.data(), intervals.size()));
+   }
+
+
+  /**
+   * Bitset of the days 0-199 of a set.
+   *
+   * @param[in] days Set
+   * @return Bitset
+   */
+  auto bits(const DateIntervalSet &days) -> std::bitset<200>
+   {
+    std::bitset<200> result;
+    for (const DateInterval &interval : days)
+     {
+      for (unsigned long day = interval.getFirst().getJD(); day <= interval.getLast().getJD(); ++day)
+       {
+        result.set(day);
+       }
+     }
+    return(result);
+   }
+
+
+  /**
+   * Pseudo random intervals within the days 0-199.
+   *
+   * @param[in,out] seed Random seed
+   * @param[in] count Number of intervals
+   * @return Intervals
+   */
+  auto random(unsigned long &seed, const std::size_t count) -> std::vector<DateInterval>
+   {
+    std::vector<DateInterval> result;
+    for (std::size_t i = 0; i < count; ++i)
+     {
+      seed = (seed * 6364136223846793005UL) + 1442695040888963407UL;
+      const unsigned long first = (seed >> 33U) % 190;
+      const unsigned long length = (seed >> 17U) % 10;
+      result.emplace_back(JD(first), JD(first + length));
+     }
+    return(result);
+   }
+
+
+  TEST(DateIntervalSetTest, constructor1)
+   {
+    const DateIntervalSet days;
+    ASSERT_TRUE(days.empty());
+    ASSERT_EQ(days.size(), 0);
+    ASSERT_EQ(days.getTotalDays(), Days(0));
+   }
+
+
+  TEST(DateIntervalSetTest, constructor2)
+   {
+    const DateIntervalSet days = set({DateInterval(JD(20), JD(25)), DateInterval(JD(1), JD(3)), DateInterval(JD(4), JD(5)), DateInterval(JD(22), JD(30)), DateInterval(JD(40), JD(40))});
+    ASSERT_EQ(days.size(), 3);
+    ASSERT_EQ(days[0], DateInterval(JD(1), JD(5)));
+    ASSERT_EQ(days[1], DateInterval(JD(20), JD(30)));
+    ASSERT_EQ(days[2], DateInterval(JD(40), JD(40)));
+    ASSERT_EQ(days.getTotalDays(), Days(17));
+   }
+
+
+  TEST(DateIntervalSetTest, contains1)
+   {
+    const DateIntervalSet days = set({DateInterval(JD(1), JD(5)), DateInterval(JD(20), JD(30))});
+    ASSERT_FALSE(days.contains(JD(0)));
+    ASSERT_TRUE(days.contains(JD(1)));
+    ASSERT_TRUE(days.contains(JD(5)));
+    ASSERT_FALSE(days.contains(JD(6)));
+    ASSERT_TRUE(days.contains(JD(25)));
+    ASSERT_FALSE(days.contains(JD(31)));
+   }
+
+
+  TEST(DateIntervalSetTest, getGaps1)
+   {
+    const DateIntervalSet days = set({DateInterval(JD(1), JD(5)), DateInterval(JD(20), JD(30)), DateInterval(JD(32), JD(40))});
+    ASSERT_EQ(days.getGaps(), set({DateInterval(JD(6), JD(19)), DateInterval(JD(31), JD(31))}));
+    ASSERT_TRUE(set({DateInterval(JD(1), JD(5))}).getGaps().empty());
+   }
+
+
+  TEST(DateIntervalSetTest, unite1)
+   {
+    const DateIntervalSet lhs = set({DateInterval(JD(1), JD(5)), DateInterval(JD(20), JD(30))});
+    const DateIntervalSet rhs = set({DateInterval(JD(6), JD(10)), DateInterval(JD(25), JD(35)), DateInterval(JD(50), JD(60))});
+    ASSERT_EQ(lhs | rhs, set({DateInterval(JD(1), JD(10)), DateInterval(JD(20), JD(35)), DateInterval(JD(50), JD(60))}));
+    ASSERT_EQ(lhs | DateIntervalSet(), lhs);
+   }
+
+
+  TEST(DateIntervalSetTest, intersect1)
+   {
+    const DateIntervalSet lhs = set({DateInterval(JD(1), JD(10)), DateInterval(JD(20), JD(30))});
+    const DateIntervalSet rhs = set({DateInterval(JD(5), JD(22)), DateInterval(JD(25), JD(26)), DateInterval(JD(30), JD(40))});
+    ASSERT_EQ(lhs & rhs, set({DateInterval(JD(5), JD(10)), DateInterval(JD(20), JD(22)), DateInterval(JD(25), JD(26)), DateInterval(JD(30), JD(30))}));
+    ASSERT_TRUE((lhs & DateIntervalSet()).empty());
+   }
+
+
+  TEST(DateIntervalSetTest, subtract1)
+   {
+    const DateIntervalSet lhs = set({DateInterval(JD(1), JD(10)), DateInterval(JD(20), JD(30))});
+    const DateIntervalSet rhs = set({DateInterval(JD(3), JD(4)), DateInterval(JD(8), JD(22)), DateInterval(JD(30), JD(40))});
+    ASSERT_EQ(lhs - rhs, set({DateInterval(JD(1), JD(2)), DateInterval(JD(5), JD(7)), DateInterval(JD(23), JD(29))}));
+    ASSERT_EQ(lhs - DateIntervalSet(), lhs);
+    ASSERT_TRUE((lhs - lhs).empty());
+   }
+
+
+  TEST(DateIntervalSetTest, subtract2)
+   {
+    const DateIntervalSet lhs = set({DateInterval(JD(0), JD(ULONG_MAX))});
+    const DateIntervalSet rhs = set({DateInterval(JD(10), JD(20))});
+    ASSERT_EQ(lhs - rhs, set({DateInterval(JD(0), JD(9)), DateInterval(JD(21), JD(ULONG_MAX))}));
+    ASSERT_TRUE((rhs - lhs).empty());
+   }
+
+
+  TEST(DateIntervalSetTest, bruteForce1)
+   {
+    // Set operations against bitsets
+    unsigned long seed = 42;
+    for (unsigned long round = 0; round < 200; ++round)
+     {
+      const DateIntervalSet lhs = set(random(seed, round % 20));
+      const DateIntervalSet rhs = set(random(seed, (round / 10) % 20));
+      ASSERT_EQ(bits(lhs | rhs), bits(lhs) | bits(rhs));
+      ASSERT_EQ(bits(lhs & rhs), bits(lhs) & bits(rhs));
+      ASSERT_EQ(bits(lhs - rhs), bits(lhs) & ~bits(rhs));
+      ASSERT_EQ(lhs.getTotalDays(), Days(bits(lhs).count()));
+      for (const DateIntervalSet &result : {lhs | rhs, lhs & rhs, lhs - rhs})
+       {
+        for (std::size_t i = 1; i < result.size(); ++i)
+         {
+          ASSERT_GT(result[i].getFirst().getJD(), result[i - 1].getLast().getJD() + 1);
+         }
+       }
+     }
+   }
+
+
+  TEST(DateIntervalSetTest, output1)
+   {
+    std::stringstream stream;
+    stream << set({DateInterval(JD(1), JD(5)), DateInterval(JD(20), JD(30))});
+    ASSERT_EQ(stream.str(), "DateIntervalSet(DateInterval(1, 5)DateInterval(20, 30))");
+   }
+
+ }
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include "DateInterval.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(DateIntervalTest, constructor1)
+   {
+    constexpr DateInterval interval {JD(10), JD(20)};
+    ASSERT_EQ(interval.getFirst(), JD(10));
+    ASSERT_EQ(interval.getLast(), JD(20));
+    ASSERT_EQ(interval.getLength(), Days(11));
+   }
+
+
+  TEST(DateIntervalTest, constructor2)
+   {
+    try
+     {
+      const DateInterval interval {JD(2), JD(1)};
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"first > last"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(DateIntervalTest, constructor3)
+   {
+    const DateInterval interval {JulianDate(JulianYear(2024), JulianMonth(2), JulianDay(1)), JulianDate(JulianYear(2024), JulianMonth(2), JulianDay(29))};
+    ASSERT_EQ(interval.getLength(), Days(29));
+   }
+
+
+  TEST(DateIntervalTest, contains1)
+   {
+    constexpr DateInterval interval {JD(10), JD(20)};
+    ASSERT_FALSE(interval.contains(JD(9)));
+    ASSERT_TRUE(interval.contains(JD(10)));
+    ASSERT_TRUE(interval.contains(JD(20)));
+    ASSERT_FALSE(interval.contains(JD(21)));
+   }
+
+
+  TEST(DateIntervalTest, overlaps1)
+   {
+    constexpr DateInterval interval {JD(10), JD(20)};
+    ASSERT_TRUE(interval.overlaps(DateInterval(JD(20), JD(30))));
+    ASSERT_TRUE(interval.overlaps(DateInterval(JD(1), JD(10))));
+    ASSERT_TRUE(interval.overlaps(DateInterval(JD(12), JD(13))));
+    ASSERT_FALSE(interval.overlaps(DateInterval(JD(21), JD(30))));
+    ASSERT_FALSE(interval.overlaps(DateInterval(JD(1), JD(9))));
+   }
+
+
+  TEST(DateIntervalTest, compare1)
+   {
+    constexpr DateInterval interval {JD(10), JD(20)};
+    ASSERT_TRUE(interval == DateInterval(JD(10), JD(20)));
+    ASSERT_TRUE(interval != DateInterval(JD(10), JD(21)));
+    ASSERT_TRUE(interval < DateInterval(JD(10), JD(21)));
+    ASSERT_TRUE(interval < DateInterval(JD(11), JD(12)));
+    ASSERT_TRUE(interval > DateInterval(JD(9), JD(30)));
+    ASSERT_TRUE(interval <= DateInterval(JD(10), JD(20)));
+    ASSERT_TRUE(interval >= DateInterval(JD(10), JD(20)));
+   }
+
+
+  TEST(DateIntervalTest, output1)
+   {
+    std::stringstream stream;
+    stream << DateInterval(JD(10), JD(20));
+    ASSERT_EQ(stream.str(), "DateInterval(10, 20)");
+   }
+
+ }
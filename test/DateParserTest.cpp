@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include "DateParser.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(DateParserTest, parseJulianJD1)
+   {
+    const std::string text {"0008-01-01"};
+    unsigned long jd = 0;
+    const std::from_chars_result result = parseJulianJD(text.data(), text.data() + text.size(), jd);
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(result.ptr, text.data() + text.size());
+    ASSERT_EQ(jd, minJulianJD);
+   }
+
+
+  TEST(DateParserTest, parseJulianJD2)
+   {
+    const std::string text {"32767-12-31"};
+    unsigned long jd = 0;
+    const std::from_chars_result result = parseJulianJD(text.data(), text.data() + text.size(), jd);
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(jd, maxJulianJD);
+   }
+
+
+  TEST(DateParserTest, parseJulianJD3)
+   {
+    const std::string text {"0012-060"};
+    unsigned long jd = 0;
+    const std::from_chars_result result = parseJulianJD(text.data(), text.data() + text.size(), jd);
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(result.ptr, text.data() + text.size());
+    ASSERT_EQ(jd, julianToJD(12, 2, 29));
+   }
+
+
+  TEST(DateParserTest, parseJulianJD4)
+   {
+    const std::string text {"0008-W01-1"};
+    unsigned long jd = 0;
+    const std::from_chars_result result = parseJulianJD(text.data(), text.data() + text.size(), jd);
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(result.ptr, text.data() + text.size());
+    ASSERT_EQ(jd, julianToJD(8, 1, 2));
+   }
+
+
+  TEST(DateParserTest, parseJulianJD5)
+   {
+    const std::string text {"1582-10-04;1582-10-05"};
+    unsigned long jd = 0;
+    const std::from_chars_result result = parseJulianJD(text.data(), text.data() + text.size(), jd);
+    ASSERT_EQ(result.ec, std::errc{});
+    ASSERT_EQ(*result.ptr, ';');
+    ASSERT_EQ(jd, 2299160);
+   }
+
+
+  TEST(DateParserTest, parseJulianJD6)
+   {
+    for (const char *text : {"", "2024", "2024-", "2024-1-01", "2024-01-1", "x2024-01-01", "2024/01/01", "2024-W1-1", "2024-W01", "123-01-01"})
+     {
+      unsigned long jd = 1;
+      const std::from_chars_result result = parseJulianJD(text, text + std::strlen(text), jd);
+      ASSERT_EQ(result.ec, std::errc::invalid_argument) << text;
+      ASSERT_EQ(result.ptr, text);
+      ASSERT_EQ(jd, 1);
+     }
+   }
+
+
+  TEST(DateParserTest, parseJulianJD7)
+   {
+    for (const char *text : {"0007-12-31", "2023-02-29", "2024-13-01", "2024-00-10", "2023-366", "32768-01-01", "2024-W54-1", "2023-W53-1", "2024-W01-8", "0007-W52-6", "0006-W52-7"})
+     {
+      unsigned long jd = 1;
+      const std::from_chars_result result = parseJulianJD(text, text + std::strlen(text), jd);
+      ASSERT_EQ(result.ec, std::errc::result_out_of_range) << text;
+      ASSERT_EQ(result.ptr, text + std::strlen(text));
+      ASSERT_EQ(jd, 1);
+     }
+   }
+
+
+  TEST(DateParserTest, parseJulianJD8)
+   {
+    char text[16] = {};
+    for (unsigned long jd = minJulianJD; jd <= maxJulianJD; jd += 13)
+     {
+      const YearMonthDay ymd = jdToJulian(jd);
+      const int size = std::snprintf(text, sizeof(text), "%04ld-%02u-%02u", ymd.year, ymd.month, ymd.day);
+      unsigned long result = 0;
+      ASSERT_EQ(parseJulianJD(text, text + size, result).ec, std::errc{});
+      ASSERT_EQ(result, jd);
+     }
+   }
+
+
+  TEST(DateParserTest, fromCharsJulianDate)
+   {
+    const std::string text {"0012-02-29"};
+    JulianDate date {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    ASSERT_EQ(fromChars(text.data(), text.data() + text.size(), date).ec, std::errc{});
+    ASSERT_EQ(date, JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29)));
+   }
+
+
+  TEST(DateParserTest, fromCharsJD)
+   {
+    const std::string text {"1582-10-04"};
+    JD jd {0};
+    ASSERT_EQ(fromChars(text.data(), text.data() + text.size(), jd).ec, std::errc{});
+    ASSERT_EQ(jd.getJD(), 2299160);
+   }
+
+
+  TEST(DateParserTest, fromCharsMJD1)
+   {
+    const std::string text {"1858-11-05"};
+    MJD mjd {1};
+    ASSERT_EQ(fromChars(text.data(), text.data() + text.size(), mjd).ec, std::errc{});
+    ASSERT_EQ(mjd.getMJD(), 0);
+   }
+
+
+  TEST(DateParserTest, fromCharsMJD2)
+   {
+    const std::string text {"1858-11-04"};
+    MJD mjd {1};
+    ASSERT_EQ(fromChars(text.data(), text.data() + text.size(), mjd).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(mjd.getMJD(), 1);
+   }
+
+ }
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include "DayNumber.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(DayNumberTest, julianToJD1)
+   {
+    constexpr unsigned long jd = julianToJD(8, 1, 1);
+    ASSERT_EQ(jd, minJulianJD);
+   }
+
+
+  TEST(DayNumberTest, julianToJD2)
+   {
+    constexpr unsigned long jd = julianToJD(32767, 12, 31);
+    ASSERT_EQ(jd, maxJulianJD);
+   }
+
+
+  TEST(DayNumberTest, julianToJD3)
+   {
+    constexpr unsigned long jd = julianToJD(1582, 10, 4);
+    ASSERT_EQ(jd, 2299160);
+   }
+
+
+  TEST(DayNumberTest, julianToJD4)
+   {
+    ASSERT_EQ(julianToJD(12, 3, 1) - julianToJD(12, 2, 28), 2);
+    ASSERT_EQ(julianToJD(13, 3, 1) - julianToJD(13, 2, 28), 1);
+   }
+
+
+  TEST(DayNumberTest, jdToJulian1)
+   {
+    constexpr YearMonthDay ymd = jdToJulian(minJulianJD);
+    ASSERT_EQ(ymd.year, 8);
+    ASSERT_EQ(ymd.month, 1);
+    ASSERT_EQ(ymd.day, 1);
+   }
+
+
+  TEST(DayNumberTest, jdToJulian2)
+   {
+    constexpr YearMonthDay ymd = jdToJulian(maxJulianJD);
+    ASSERT_EQ(ymd.year, 32767);
+    ASSERT_EQ(ymd.month, 12);
+    ASSERT_EQ(ymd.day, 31);
+   }
+
+
+  TEST(DayNumberTest, jdToJulian3)
+   {
+    constexpr YearMonthDay ymd = jdToJulian(julianToJD(12, 2, 29));
+    ASSERT_EQ(ymd.year, 12);
+    ASSERT_EQ(ymd.month, 2);
+    ASSERT_EQ(ymd.day, 29);
+   }
+
+
+  TEST(DayNumberTest, julianDayWithinYear1)
+   {
+    ASSERT_EQ(julianDayWithinYear(13, 3, 1), 60);
+   }
+
+
+  TEST(DayNumberTest, julianDayWithinYear2)
+   {
+    ASSERT_EQ(julianDayWithinYear(12, 3, 1), 61);
+   }
+
+
+  TEST(DayNumberTest, julianDayWithinYear3)
+   {
+    ASSERT_EQ(julianDayWithinYear(12, 12, 31), 366);
+   }
+
+
+  TEST(DayNumberTest, julianFromDayWithinYear1)
+   {
+    constexpr YearMonthDay ymd = julianFromDayWithinYear(13, 60);
+    ASSERT_EQ(ymd.year, 13);
+    ASSERT_EQ(ymd.month, 3);
+    ASSERT_EQ(ymd.day, 1);
+   }
+
+
+  TEST(DayNumberTest, julianFromDayWithinYear2)
+   {
+    constexpr YearMonthDay ymd = julianFromDayWithinYear(12, 60);
+    ASSERT_EQ(ymd.year, 12);
+    ASSERT_EQ(ymd.month, 2);
+    ASSERT_EQ(ymd.day, 29);
+   }
+
+
+  TEST(DayNumberTest, julianFromDayWithinYear3)
+   {
+    for (unsigned short dayWithinYear = 1; dayWithinYear <= 366; ++dayWithinYear)
+     {
+      const YearMonthDay ymd = julianFromDayWithinYear(12, dayWithinYear);
+      ASSERT_EQ(julianDayWithinYear(ymd.year, ymd.month, ymd.day), dayWithinYear);
+     }
+   }
+
+
+  TEST(DayNumberTest, isGregorianLeapYear1)
+   {
+    ASSERT_TRUE(isGregorianLeapYear(2000));
+    ASSERT_TRUE(isGregorianLeapYear(2024));
+    ASSERT_FALSE(isGregorianLeapYear(1900));
+    ASSERT_FALSE(isGregorianLeapYear(2023));
+   }
+
+
+  TEST(DayNumberTest, gregorianToJD1)
+   {
+    constexpr unsigned long jd = gregorianToJD(1, 1, 1);
+    ASSERT_EQ(jd, minGregorianJD);
+   }
+
+
+  TEST(DayNumberTest, gregorianToJD2)
+   {
+    constexpr unsigned long jd = gregorianToJD(32767, 12, 31);
+    ASSERT_EQ(jd, maxGregorianJD);
+   }
+
+
+  TEST(DayNumberTest, gregorianToJD3)
+   {
+    ASSERT_EQ(gregorianToJD(1582, 10, 15), julianToJD(1582, 10, 4) + 1);
+    ASSERT_EQ(gregorianToJD(2000, 1, 1), 2451545);
+   }
+
+
+  TEST(DayNumberTest, jdToGregorian1)
+   {
+    for (unsigned long jd = minGregorianJD; jd <= maxGregorianJD; jd += 97)
+     {
+      const YearMonthDay ymd = jdToGregorian(jd);
+      ASSERT_EQ(gregorianToJD(ymd.year, ymd.month, ymd.day), jd);
+     }
+   }
+
+
+  TEST(DayNumberTest, jdToGregorian2)
+   {
+    constexpr YearMonthDay ymd = jdToGregorian(gregorianToJD(1900, 3, 1) - 1);
+    ASSERT_EQ(ymd.year, 1900);
+    ASSERT_EQ(ymd.month, 2);
+    ASSERT_EQ(ymd.day, 28);
+   }
+
+
+  TEST(DayNumberTest, gregorianWeeksInYear1)
+   {
+    ASSERT_EQ(gregorianWeeksInYear(2015), 53);
+    ASSERT_EQ(gregorianWeeksInYear(2020), 53);
+    ASSERT_EQ(gregorianWeeksInYear(2021), 52);
+   }
+
+
+  TEST(DayNumberTest, gregorianFromDayWithinYear1)
+   {
+    for (unsigned short dayWithinYear = 1; dayWithinYear <= 365; ++dayWithinYear)
+     {
+      const YearMonthDay ymd = gregorianFromDayWithinYear(1900, dayWithinYear);
+      ASSERT_EQ(gregorianDayWithinYear(ymd.year, ymd.month, ymd.day), dayWithinYear);
+     }
+   }
+
+
+
+  TEST(DayNumberTest, julianYearTable1)
+   {
+    for (long year = 8; year <= 32767; ++year)
+     {
+      const unsigned long jan1 = julianToJD(year, 1, 1);
+      const unsigned short firstWeekday = jdToWeekday(jan1);
+      ASSERT_EQ(julianFirstJD(year), jan1);
+      ASSERT_EQ(julianFirstWeekday(year), firstWeekday);
+      ASSERT_EQ(julianFirstWeekShift(year), jdToWeekday(julianToJD(year, 1, 4)) - 1U);
+      ASSERT_EQ(julianWeeksInYear(year), ((firstWeekday == 4) || (((year % 4) == 0) && (firstWeekday == 3))) ? 53 : 52);
+     }
+   }
+
+
+  TEST(DayNumberTest, julianFirstJD1)
+   {
+    constexpr unsigned long jd = julianFirstJD(8);
+    ASSERT_EQ(jd, minJulianJD);
+   }
+
+
+  TEST(DayNumberTest, julianEaster1)
+   {
+    for (long year = 8; year <= 32767; ++year)
+     {
+      const long a = ((19 * (year % 19)) + 15) % 30;
+      const long b = ((2 * (year % 4)) + (4 * (year % 7)) - a + 34) % 7;
+      const long c = a + b + 114;
+      const YearMonthDay easter = julianEaster(year);
+      ASSERT_EQ(easter.year, year);
+      ASSERT_EQ(easter.month, c / 31);
+      ASSERT_EQ(easter.day, (c % 31) + 1);
+     }
+   }
+
+
+  TEST(DayNumberTest, julianEaster2)
+   {
+    constexpr YearMonthDay easter1 = julianEaster(2024);
+    constexpr YearMonthDay easter2 = julianEaster(2024 + 532);
+    ASSERT_EQ(easter1.month, 4);
+    ASSERT_EQ(easter1.day, 22);
+    ASSERT_EQ(easter2.month, easter1.month);
+    ASSERT_EQ(easter2.day, easter1.day);
+   }
+
+ }
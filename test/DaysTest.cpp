@@ -48,6 +48,24 @@ namespace
    }
 
 
+  TEST(DaysTest, copyAssignment)
+   {
+    const Days days1 {12};
+    Days days2 {1};
+    days2 = days1;
+    ASSERT_EQ(days2.getDays(), 12);
+   }
+
+
+  TEST(DaysTest, moveAssignment)
+   {
+    Days days1 {12};
+    Days days2 {1};
+    days2 = std::move(days1);
+    ASSERT_EQ(days2.getDays(), 12);
+   }
+
+
   TEST(DaysTest, equalOperator1)
    {
     constexpr Days days1 {12};
@@ -89,6 +89,28 @@ namespace
    }
 
 
+  TEST(DurationTest, copyAssignment)
+   {
+    const Duration duration1 {Years(12), Months(11), Days(12)};
+    Duration duration2 {Years(1), Months(1), Days(1)};
+    duration2 = duration1;
+    ASSERT_EQ(duration2.getYears().getYears(), 12);
+    ASSERT_EQ(duration2.getMonths().getMonths(), 11);
+    ASSERT_EQ(duration2.getDays().getDays(), 12);
+   }
+
+
+  TEST(DurationTest, moveAssignment)
+   {
+    Duration duration1 {Years(12), Months(11), Days(12)};
+    Duration duration2 {Years(1), Months(1), Days(1)};
+    duration2 = std::move(duration1);
+    ASSERT_EQ(duration2.getYears().getYears(), 12);
+    ASSERT_EQ(duration2.getMonths().getMonths(), 11);
+    ASSERT_EQ(duration2.getDays().getDays(), 12);
+   }
+
+
   TEST(DurationTest, equalOperator1)
    {
     constexpr Duration duration1 {Years(12), Months(11), Days(12)};
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <type_traits>
+#include "Expected.h"
+#include "Days.h"
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(ExpectedTest, constructor1)
+   {
+    constexpr Expected<Days> days {Days(1)};
+    ASSERT_TRUE(days.hasValue());
+    ASSERT_TRUE(static_cast<bool>(days));
+    ASSERT_EQ(days.getValue().getDays(), 1);
+    ASSERT_EQ(days.getError(), ValidationError::None);
+   }
+
+
+  TEST(ExpectedTest, constructor2)
+   {
+    constexpr Expected<Days> days {ValidationError::DayOutOfRange};
+    ASSERT_FALSE(days.hasValue());
+    ASSERT_FALSE(static_cast<bool>(days));
+    ASSERT_EQ(days.getError(), ValidationError::DayOutOfRange);
+   }
+
+
+  TEST(ExpectedTest, copyConstructor)
+   {
+    constexpr Expected<Days> days1 {Days(1)};
+    constexpr Expected<Days> days2 {days1};
+    ASSERT_EQ(days2.getValue().getDays(), 1);
+   }
+
+
+  TEST(ExpectedTest, copyAssignment)
+   {
+    const Expected<Days> days1 {Days(1)};
+    Expected<Days> days2 {ValidationError::DayOutOfRange};
+    days2 = days1;
+    ASSERT_TRUE(days2.hasValue());
+    ASSERT_EQ(days2.getValue().getDays(), 1);
+   }
+
+
+  TEST(ExpectedTest, constructor3)
+   {
+    EXPECT_DEBUG_DEATH({[[maybe_unused]] const Expected<Days> days(ValidationError::None);}, "");
+   }
+
+
+  TEST(ExpectedTest, getValue1)
+   {
+    const Expected<Days> days {ValidationError::DayOutOfRange};
+    EXPECT_DEBUG_DEATH({[[maybe_unused]] const Days value = days.getValue();}, "");
+   }
+
+
+  TEST(ExpectedTest, noexcept1)
+   {
+    ASSERT_TRUE(std::is_nothrow_copy_constructible_v<Expected<Days>>);
+    ASSERT_TRUE(std::is_trivially_destructible_v<Expected<Days>>);
+   }
+
+ }
@@ -0,0 +1,1107 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include "GregorianDate.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(GregorianDateTest, constructor1)
+   {
+    constexpr GregorianDate date {GregorianYear(8), GregorianMonth(1), GregorianDay(1)};
+    ASSERT_EQ(date.getDay().getDay(), 1);
+    ASSERT_EQ(date.getMonth().getMonth(), 1);
+    ASSERT_EQ(date.getYear().getYear(), 8);
+   }
+
+
+  TEST(GregorianDateTest, constructor2)
+   {
+    constexpr GregorianDate date {GregorianYear(32767), GregorianMonth(12), GregorianDay(31)};
+    ASSERT_EQ(date.getDay().getDay(), 31);
+    ASSERT_EQ(date.getMonth().getMonth(), 12);
+    ASSERT_EQ(date.getYear().getYear(), 32767);
+   }
+
+
+  TEST(GregorianDateTest, constructor3)
+   {
+    try
+     {
+      [[maybe_unused]] GregorianDate date {GregorianYear(0), GregorianMonth(1), GregorianDay(1)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year is < 1 or > 32767").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, constructor4)
+   {
+    try
+     {
+      [[maybe_unused]] GregorianDate date {GregorianYear(32768), GregorianMonth(1), GregorianDay(1)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year is < 1 or > 32767").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, constructor5)
+   {
+    constexpr JD jd {1721426};
+    constexpr GregorianDate date {jd};
+    ASSERT_EQ(date.getDay().getDay(), 1);
+    ASSERT_EQ(date.getMonth().getMonth(), 1);
+    ASSERT_EQ(date.getYear().getYear(), 1);
+   }
+
+
+  TEST(GregorianDateTest, constructor6)
+   {
+    constexpr JD jd {2299161};
+    constexpr GregorianDate date {jd};
+    ASSERT_EQ(date.getDay().getDay(), 15);
+    ASSERT_EQ(date.getMonth().getMonth(), 10);
+    ASSERT_EQ(date.getYear().getYear(), 1582);
+   }
+
+
+  TEST(GregorianDateTest, constructor8)
+   {
+    constexpr JD jd {13689325};
+    constexpr GregorianDate date {jd};
+    ASSERT_EQ(date.getDay().getDay(), 31);
+    ASSERT_EQ(date.getMonth().getMonth(), 12);
+    ASSERT_EQ(date.getYear().getYear(), 32767);
+   }
+
+
+  TEST(GregorianDateTest, constructor9)
+   {
+    constexpr JD jd {1725502};
+    constexpr GregorianDate date {jd};
+    ASSERT_EQ(date.getDay().getDay(), 29);
+    ASSERT_EQ(date.getMonth().getMonth(), 2);
+    ASSERT_EQ(date.getMonth().getDaysInMonth().getDays(), 29);
+    ASSERT_EQ(date.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, constructor10)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDate date {JD(1721425)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year is < 1 or > 32767").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, constructor11)
+   {
+    constexpr GregorianDate date {GregorianYear(12), Days(60)};
+    ASSERT_EQ(date.getYear().getYear(), 12);
+    ASSERT_EQ(date.getMonth().getMonth(), 2);
+    ASSERT_EQ(date.getDay().getDay(), 29);
+   }
+
+
+  TEST(GregorianDateTest, constructor12)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDate date {GregorianYear(13), Days(366)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("day within year is < 1 or > 365").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, constructor7)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDate date {GregorianYear(8), GregorianMonth(2), GregorianDay(30)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("day is > 29").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, tryMake1)
+   {
+    constexpr Expected<GregorianDate> date = GregorianDate::tryMake(12, 2, 29);
+    ASSERT_TRUE(date.hasValue());
+    ASSERT_EQ(date.getValue(), GregorianDate(GregorianYear(12), GregorianMonth(2), GregorianDay(29)));
+   }
+
+
+  TEST(GregorianDateTest, tryMake2)
+   {
+    constexpr Expected<GregorianDate> date = GregorianDate::tryMake(0, 12, 31);
+    ASSERT_EQ(date.getError(), ValidationError::YearOutOfRange);
+   }
+
+
+  TEST(GregorianDateTest, tryMake3)
+   {
+    constexpr Expected<GregorianDate> date = GregorianDate::tryMake(12, 13, 1);
+    ASSERT_EQ(date.getError(), ValidationError::MonthOutOfRange);
+   }
+
+
+  TEST(GregorianDateTest, tryMake4)
+   {
+    constexpr Expected<GregorianDate> date = GregorianDate::tryMake(13, 2, 29);
+    ASSERT_EQ(date.getError(), ValidationError::DayOutOfRange);
+   }
+
+
+  TEST(GregorianDateTest, tryMake5)
+   {
+    constexpr Expected<GregorianDate> date = GregorianDate::tryMake(JD(1725502));
+    ASSERT_TRUE(date.hasValue());
+    ASSERT_EQ(date.getValue(), GregorianDate(GregorianYear(12), GregorianMonth(2), GregorianDay(29)));
+   }
+
+
+  TEST(GregorianDateTest, tryMake6)
+   {
+    constexpr Expected<GregorianDate> date = GregorianDate::tryMake(JD(1721425));
+    ASSERT_EQ(date.getError(), ValidationError::JDOutOfRange);
+   }
+
+
+  TEST(GregorianDateTest, uncheckedConstructor1)
+   {
+    constexpr GregorianDate date {unchecked, 12, 2, 29};
+    ASSERT_EQ(date, GregorianDate(GregorianYear(12), GregorianMonth(2), GregorianDay(29)));
+   }
+
+
+  TEST(GregorianDateTest, uncheckedConstructor2)
+   {
+    constexpr GregorianDate date {unchecked, JD(1725502)};
+    ASSERT_EQ(date, GregorianDate(GregorianYear(12), GregorianMonth(2), GregorianDay(29)));
+   }
+
+
+  TEST(GregorianDateTest, uncheckedConstructor3)
+   {
+    EXPECT_DEBUG_DEATH({[[maybe_unused]] const GregorianDate date(unchecked, 13, 2, 29);}, "");
+   }
+
+
+  TEST(GregorianDateTest, copyConstructor)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {date1};
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+    ASSERT_TRUE(&date1 != &date2);
+   }
+
+
+  TEST(GregorianDateTest, moveConstructor)
+   {
+    GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    const GregorianDate date2 {std::move(date1)};
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, copyAssignment)
+   {
+    const GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    GregorianDate date2 {GregorianYear(8), GregorianMonth(1), GregorianDay(1)};
+    date2 = date1;
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, moveAssignment)
+   {
+    GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    GregorianDate date2 {GregorianYear(8), GregorianMonth(1), GregorianDay(1)};
+    date2 = std::move(date1);
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, triviallyCopyable)
+   {
+    ASSERT_TRUE(std::is_trivially_copyable_v<GregorianDate>);
+    ASSERT_TRUE(std::is_copy_assignable_v<GregorianDate>);
+    ASSERT_TRUE(std::is_move_assignable_v<GregorianDate>);
+   }
+
+
+  TEST(GregorianDateTest, sort)
+   {
+    std::vector<GregorianDate> dates {GregorianDate(GregorianYear(13), GregorianMonth(1), GregorianDay(1)), GregorianDate(GregorianYear(12), GregorianMonth(12), GregorianDay(31)), GregorianDate(GregorianYear(12), GregorianMonth(1), GregorianDay(12))};
+    std::sort(dates.begin(), dates.end());
+    ASSERT_EQ(dates[0], GregorianDate(GregorianYear(12), GregorianMonth(1), GregorianDay(12)));
+    ASSERT_EQ(dates[1], GregorianDate(GregorianYear(12), GregorianMonth(12), GregorianDay(31)));
+    ASSERT_EQ(dates[2], GregorianDate(GregorianYear(13), GregorianMonth(1), GregorianDay(1)));
+   }
+
+
+  TEST(GregorianDateTest, getDay)
+   {
+    constexpr GregorianDate date {GregorianYear(8), GregorianMonth(2), GregorianDay(1)};
+    ASSERT_EQ(date.getDay().getDay(), 1);
+   }
+
+
+  TEST(GregorianDateTest, getMonth)
+   {
+    constexpr GregorianDate date {GregorianYear(8), GregorianMonth(2), GregorianDay(1)};
+    ASSERT_EQ(date.getMonth().getMonth(), 2);
+   }
+
+
+  TEST(GregorianDateTest, getYear)
+   {
+    constexpr GregorianDate date {GregorianYear(8), GregorianMonth(2), GregorianDay(1)};
+    ASSERT_EQ(date.getYear().getYear(), 8);
+   }
+
+
+  TEST(GregorianDateTest, getWeekday1)
+   {
+    constexpr GregorianDate date {GregorianYear(1582), GregorianMonth(10), GregorianDay(15)};
+    ASSERT_EQ(date.getWeekday(), Weekdays::Friday);
+   }
+
+
+  TEST(GregorianDateTest, getWeekday2)
+   {
+    constexpr GregorianDate date {GregorianYear(2024), GregorianMonth(10), GregorianDay(16)};
+    ASSERT_EQ(date.getWeekday(), Weekdays::Wednesday);
+   }
+
+
+  TEST(GregorianDateTest, getDayWithinYear1)
+   {
+    constexpr GregorianDate date {GregorianYear(8), GregorianMonth(1), GregorianDay(1)};
+    ASSERT_EQ(date.getDayWithinYear().getDays(), 1);
+   }
+
+
+  TEST(GregorianDateTest, getDayWithinYear2)
+   {
+    constexpr GregorianDate date {GregorianYear(8), GregorianMonth(12), GregorianDay(31)};
+    ASSERT_EQ(date.getDayWithinYear().getDays(), 366);
+   }
+
+
+  TEST(GregorianDateTest, getDayWithinYear3)
+   {
+    constexpr GregorianDate date {GregorianYear(9), GregorianMonth(12), GregorianDay(31)};
+    ASSERT_EQ(date.getDayWithinYear().getDays(), 365);
+   }
+
+
+  TEST(GregorianDateTest, getWeek1)
+   {
+    constexpr GregorianDate date {GregorianYear(2021), GregorianMonth(1), GregorianDay(1)};
+    ASSERT_EQ(date.getWeek().getWeek(), 53);
+   }
+
+
+  TEST(GregorianDateTest, getWeek2)
+   {
+    constexpr GregorianDate date {GregorianYear(2020), GregorianMonth(12), GregorianDay(31)};
+    ASSERT_EQ(date.getWeek().getWeek(), 53);
+   }
+
+
+  TEST(GregorianDateTest, getWeek3)
+   {
+    constexpr GregorianDate date {GregorianYear(2024), GregorianMonth(12), GregorianDay(30)};
+    ASSERT_EQ(date.getWeek().getWeek(), 1);
+   }
+
+
+  TEST(GregorianDateTest, getWeek4)
+   {
+    constexpr GregorianDate date {GregorianYear(9), GregorianMonth(1), GregorianDay(1)};
+    ASSERT_EQ(date.getWeek().getWeek(), 1);
+   }
+
+
+  TEST(GregorianDateTest, getWeek5)
+   {
+    constexpr GregorianDate date {GregorianYear(1), GregorianMonth(1), GregorianDay(1)};
+    ASSERT_EQ(date.getWeek().getWeek(), 1);
+   }
+
+
+  TEST(GregorianDateTest, getWeek6)
+   {
+    constexpr GregorianDate date {GregorianYear(32767), GregorianMonth(1), GregorianDay(1)};
+    ASSERT_EQ(date.getWeek().getWeek(), 52);
+   }
+
+
+  TEST(GregorianDateTest, getJD1)
+   {
+    constexpr GregorianDate date {GregorianYear(8), GregorianMonth(1), GregorianDay(1)};
+    ASSERT_EQ(date.getJD().getJD(), 1723982);
+   }
+
+
+  TEST(GregorianDateTest, getJD2)
+   {
+    constexpr GregorianDate date {GregorianYear(1582), GregorianMonth(10), GregorianDay(15)};
+    ASSERT_EQ(date.getJD().getJD(), 2299161);
+   }
+
+
+  TEST(GregorianDateTest, equalOperator1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_TRUE(date1 == date2);
+   }
+
+
+  TEST(GregorianDateTest, equalOperator2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    ASSERT_FALSE(date1 == date2);
+   }
+
+
+  TEST(GregorianDateTest, notEqualOperator1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    ASSERT_TRUE(date1 != date2);
+   }
+
+
+  TEST(GregorianDateTest, notEqualOperator2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_FALSE(date1 != date2);
+   }
+
+
+  TEST(GregorianDateTest, smallerOperator1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    ASSERT_TRUE(date1 < date2);
+   }
+
+
+  TEST(GregorianDateTest, smallerOperator2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_FALSE(date1 < date2);
+   }
+
+
+  TEST(GregorianDateTest, smallerOperator3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_FALSE(date1 < date2);
+   }
+
+
+  TEST(GregorianDateTest, greaterOperator1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_TRUE(date1 > date2);
+   }
+
+
+  TEST(GregorianDateTest, greaterOperator2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    ASSERT_FALSE(date1 > date2);
+   }
+
+
+  TEST(GregorianDateTest, greaterOperator3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_FALSE(date1 > date2);
+   }
+
+
+  TEST(GregorianDateTest, smallerEqualOperator1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    ASSERT_TRUE(date1 <= date2);
+   }
+
+
+  TEST(GregorianDateTest, smallerEqualOperator2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_FALSE(date1 <= date2);
+   }
+
+
+  TEST(GregorianDateTest, smallerEqualOperator3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_TRUE(date1 <= date2);
+   }
+
+
+  TEST(GregorianDateTest, greaterEqualOperator1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_TRUE(date1 >= date2);
+   }
+
+
+  TEST(GregorianDateTest, greaterEqualOperator2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(18), GregorianMonth(12), GregorianDay(18)};
+    ASSERT_FALSE(date1 >= date2);
+   }
+
+
+  TEST(GregorianDateTest, greaterEqualOperator3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    ASSERT_TRUE(date1 >= date2);
+   }
+
+
+  TEST(GregorianDateTest, plusDays1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr Days days {6};
+    constexpr GregorianDate newDate = date1 + days;
+    ASSERT_EQ(newDate.getDay().getDay(), 18);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, plusDays2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr Days days {20};
+    constexpr GregorianDate newDate = date1 + days;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 1);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(GregorianDateTest, minusDays1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr Days days {6};
+    constexpr GregorianDate newDate = date1 - days;
+    ASSERT_EQ(newDate.getDay().getDay(), 6);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, minusDays2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12),GregorianDay(12) };
+    constexpr Days days {18};
+    constexpr GregorianDate newDate = date1 - days;
+    ASSERT_EQ(newDate.getDay().getDay(), 24);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 11);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, plusDays3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr Days days {100000};
+    constexpr GregorianDate newDate = date1 + days;
+    ASSERT_EQ(newDate.getDay().getDay(), 27);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 9);
+    ASSERT_EQ(newDate.getYear().getYear(), 286);
+   }
+
+
+  TEST(GregorianDateTest, plusDays4)
+   {
+    constexpr GregorianDate date1 {GregorianYear(32767), GregorianMonth(12), GregorianDay(31)};
+    try
+     {
+      [[maybe_unused]] const GregorianDate newDate = date1 + Days(1);
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year will be > 32767").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, minusDays3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(286), GregorianMonth(9), GregorianDay(27)};
+    constexpr Days days {100000};
+    constexpr GregorianDate newDate = date1 - days;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, minusDays4)
+   {
+    constexpr GregorianDate date1 {GregorianYear(1), GregorianMonth(1), GregorianDay(1)};
+    try
+     {
+      [[maybe_unused]] const GregorianDate newDate = date1 - Days(1);
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year will be < 1").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, plusMonths1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(6), GregorianDay(12)};
+    constexpr Months months {6};
+    constexpr GregorianDate newDate = date1 + months;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, plusMonths2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(6), GregorianDay(12)};
+    constexpr Months months {12};
+    constexpr GregorianDate newDate = date1 + months;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 6);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(GregorianDateTest, minusMonths1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(6), GregorianDay(12)};
+    constexpr Months months {3};
+    constexpr GregorianDate newDate = date1 - months;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 3);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, minusMonths2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(6), GregorianDay(12)};
+    constexpr Months months {6};
+    constexpr GregorianDate newDate = date1 - months;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 11);
+   }
+
+
+  TEST(GregorianDateTest, plusYears1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr Years years {6};
+    constexpr GregorianDate newDate = date1 + years;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 18);
+   }
+
+
+  TEST(GregorianDateTest, minusYears1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(14), GregorianMonth(12), GregorianDay(12)};
+    constexpr Years years {6};
+    constexpr GregorianDate newDate = date1 - years;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 8);
+   }
+
+
+  TEST(GregorianDateTest, plusWeeks1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Weeks weeks {2};
+    constexpr GregorianDate newDate = date1 + weeks;
+    ASSERT_EQ(newDate.getDay().getDay(), 15);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, minusWeeks1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(20)};
+    constexpr Weeks weeks {2};
+    constexpr GregorianDate newDate = date1 - weeks;
+    ASSERT_EQ(newDate.getDay().getDay(), 6);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, plusDuration1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(0), Months(0), Days(0)};
+    constexpr GregorianDate newDate = date1 + duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, plusDuration2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(0), Months(1), Days(0)};
+    constexpr GregorianDate newDate = date1 + duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 1);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(GregorianDateTest, plusDuration3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(1), Months(0), Days(0)};
+    constexpr GregorianDate newDate = date1 + duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(GregorianDateTest, plusDuration4)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(0), Months(0), Days(1)};
+    constexpr GregorianDate newDate = date1 + duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 2);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, plusDuration5)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(31)};
+    constexpr Duration duration {Years(0), Months(2), Days(0)};
+    constexpr GregorianDate newDate = date1 + duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 3);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(GregorianDateTest, minusDuration1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(0), Months(0), Days(0)};
+    constexpr GregorianDate newDate = date1 - duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, minusDuration2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(0), Months(1), Days(0)};
+    constexpr GregorianDate newDate = date1 - duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 11);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, minusDuration3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(1), Months(0), Days(0)};
+    constexpr GregorianDate newDate = date1 - duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 11);
+   }
+
+
+  TEST(GregorianDateTest, minusDuration4)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)};
+    constexpr Duration duration {Years(0), Months(0), Days(1)};
+    constexpr GregorianDate newDate = date1 - duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 30);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 11);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, minusDuration5)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(31)};
+    constexpr Duration duration {Years(0), Months(1), Days(0)};
+    constexpr GregorianDate newDate = date1 - duration;
+    ASSERT_EQ(newDate.getDay().getDay(), 30);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 11);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, plusWeekdays1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)}; // Saturday
+    constexpr Weekdays wdays {Weekdays::Monday};
+    constexpr GregorianDate newDate = date1 + wdays;
+    ASSERT_EQ(newDate.getDay().getDay(), 3);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+ 
+
+  TEST(GregorianDateTest, minusWeekdays1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(1)}; // Saturday
+    constexpr Weekdays wdays {Weekdays::Monday};
+    constexpr GregorianDate newDate = date1 - wdays;
+    ASSERT_EQ(newDate.getDay().getDay(), 26);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 11);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(GregorianDateTest, dayDiff1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(1), GregorianDay(2)};
+    constexpr Days newDays = dayDiff(date1, date2);
+    ASSERT_EQ(newDays.getDays(), 1);
+   }
+
+
+  TEST(GregorianDateTest, dayDiff2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(1), GregorianDay(2)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr Days newDays = dayDiff(date1, date2);
+    ASSERT_EQ(newDays.getDays(), 1);
+   }
+
+
+  TEST(GregorianDateTest, dayDiff3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    constexpr GregorianDate date2 {GregorianYear(13), GregorianMonth(1), GregorianDay(1)};
+    constexpr Days newDays = dayDiff(date1, date2);
+    ASSERT_EQ(newDays.getDays(), 20);
+   }
+
+
+  TEST(GregorianDateTest, dayDiff4)
+   {
+    constexpr GregorianDate date1 {GregorianYear(1), GregorianMonth(1), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(32767), GregorianMonth(12), GregorianDay(31)};
+    constexpr Days newDays = dayDiff(date1, date2);
+    ASSERT_EQ(newDays.getDays(), 11967899);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(1), GregorianDay(2)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 0);
+    ASSERT_EQ(newDuration.getDays().getDays(), 1);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate2)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(1), GregorianDay(2)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 0);
+    ASSERT_EQ(newDuration.getDays().getDays(), 1);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate3)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(2), GregorianDay(1)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 1);
+    ASSERT_EQ(newDuration.getDays().getDays(), 0);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate4)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(2), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 1);
+    ASSERT_EQ(newDuration.getDays().getDays(), 0);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate5)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(13), GregorianMonth(1), GregorianDay(1)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 1);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 0);
+    ASSERT_EQ(newDuration.getDays().getDays(), 0);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate6)
+   {
+    constexpr GregorianDate date1 {GregorianYear(13), GregorianMonth(1), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(1), GregorianDay(1)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 1);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 0);
+    ASSERT_EQ(newDuration.getDays().getDays(), 0);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate7)
+   {
+    constexpr GregorianDate date1 {GregorianYear(8), GregorianMonth(1), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(32767), GregorianMonth(12), GregorianDay(31)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 32759);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 11);
+    ASSERT_EQ(newDuration.getDays().getDays(), 30);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate8)
+   {
+    constexpr GregorianDate date1 {GregorianYear(13), GregorianMonth(1), GregorianDay(31)};
+    constexpr GregorianDate date2 {GregorianYear(13), GregorianMonth(3), GregorianDay(1)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 1);
+    ASSERT_EQ(newDuration.getDays().getDays(), 1);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate9)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(3), GregorianDay(1)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(1), GregorianDay(31)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 1);
+    ASSERT_EQ(newDuration.getDays().getDays(), 1);
+   }
+
+
+  TEST(GregorianDateTest, minusGregorianDateGregorianDate10)
+   {
+    constexpr GregorianDate date1 {GregorianYear(13), GregorianMonth(2), GregorianDay(28)};
+    constexpr GregorianDate date2 {GregorianYear(12), GregorianMonth(2), GregorianDay(29)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 11);
+    ASSERT_EQ(newDuration.getDays().getDays(), 30);
+   }
+
+
+  TEST(GregorianDateTest, getEaster1)
+   {
+    constexpr GregorianYear year {2024};
+    constexpr GregorianDate easter = getEaster(year);
+    ASSERT_EQ(easter.getMonth().getMonth(), 3);
+    ASSERT_EQ(easter.getDay().getDay(), 31);
+   }
+
+
+  TEST(GregorianDateTest, getEaster2)
+   {
+    constexpr GregorianYear year {2025};
+    constexpr GregorianDate easter = getEaster(year);
+    ASSERT_EQ(easter.getMonth().getMonth(), 4);
+    ASSERT_EQ(easter.getDay().getDay(), 20);
+   }
+
+
+  TEST(GregorianDateTest, julianDate1)
+   {
+    constexpr GregorianDate date {JulianDate(JulianYear(1582), JulianMonth(10), JulianDay(4))};
+    ASSERT_EQ(date, GregorianDate(GregorianYear(1582), GregorianMonth(10), GregorianDay(14)));
+   }
+
+
+  TEST(GregorianDateTest, julianDate2)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDate date {JulianDate(JulianYear(32767), JulianMonth(12), JulianDay(31))};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year is < 1 or > 32767").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, getJulianDate1)
+   {
+    constexpr GregorianDate date {GregorianYear(1582), GregorianMonth(10), GregorianDay(15)};
+    ASSERT_EQ(date.getJulianDate(), JulianDate(JulianYear(1582), JulianMonth(10), JulianDay(5)));
+   }
+
+
+  TEST(GregorianDateTest, getJulianDate2)
+   {
+    constexpr GregorianDate date {GregorianYear(7), GregorianMonth(12), GregorianDay(29)};
+    try
+     {
+      [[maybe_unused]] const JulianDate julianDate = date.getJulianDate();
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("julian year will be < 8").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDateTest, coutDay1)
+   {
+    constexpr GregorianDate date1 {GregorianYear(12), GregorianMonth(12), GregorianDay(12)};
+    testing::internal::CaptureStdout();
+    std::cout << date1;
+    const std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output, "GregorianDate(GregorianYear(12), GregorianMonth(12), GregorianDay(12))");
+   }
+
+
+  TEST(GregorianDateTest, factory1)
+   {
+    constexpr GregorianDate date = factory(GregorianYear(2021), GregorianWeek(1), Weekdays::Monday);
+    ASSERT_EQ(date.getYear().getYear(), 2021);
+    ASSERT_EQ(date.getMonth().getMonth(), 1);
+    ASSERT_EQ(date.getDay().getDay(), 4);
+   }
+
+
+  TEST(GregorianDateTest, factory2)
+   {
+    constexpr GregorianDate date = factory(GregorianYear(2020), GregorianWeek(53), Weekdays::Sunday);
+    ASSERT_EQ(date.getYear().getYear(), 2021);
+    ASSERT_EQ(date.getMonth().getMonth(), 1);
+    ASSERT_EQ(date.getDay().getDay(), 3);
+   }
+
+
+  TEST(GregorianDateTest, factory3)
+   {
+    constexpr GregorianDate date = factory(GregorianYear(2020), GregorianWeek(2), Weekdays::Monday);
+    ASSERT_EQ(date.getYear().getYear(), 2020);
+    ASSERT_EQ(date.getMonth().getMonth(), 1);
+    ASSERT_EQ(date.getDay().getDay(), 6);
+   }
+
+
+  TEST(GregorianDateTest, factory4)
+   {
+    constexpr GregorianDate date = factory(GregorianYear(2026), GregorianWeek(1), Weekdays::Monday);
+    ASSERT_EQ(date.getYear().getYear(), 2025);
+    ASSERT_EQ(date.getMonth().getMonth(), 12);
+    ASSERT_EQ(date.getDay().getDay(), 29);
+   }
+
+
+  TEST(GregorianDateTest, factory5)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDate date = factory(GregorianYear(32767), GregorianWeek(53), Weekdays::Monday);
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year will be > 32767").compare(e.what()), 0);
+     }
+   }
+
+ }
@@ -0,0 +1,432 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <string>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Days.h"
+#include "GregorianDay.h"
+#include "GregorianMonth.h"
+#include "GregorianYear.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(GregorianDayTest, constructor1)
+   {
+    constexpr GregorianDay day {1};
+    ASSERT_EQ(day.getDay(), 1);
+   }
+
+
+  TEST(GregorianDayTest, constructor2)
+   {
+    constexpr GregorianDay day {31};
+    ASSERT_EQ(day.getDay(), 31);
+   }
+
+
+  TEST(GregorianDayTest, constructor3)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDay day {0};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day is < 1 or > 31"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, constructor4)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDay day {32};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day is < 1 or > 31"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, constructor5)
+   {
+    constexpr GregorianDay day {GregorianMonth(1), 31};
+    ASSERT_EQ(day.getDay(), 31);
+   }
+
+
+  TEST(GregorianDayTest, constructor6)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDay day {GregorianMonth(1), 32};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day is < 1 or > 31"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, constructor7)
+   {
+    constexpr GregorianDay day {GregorianMonth(4), 30};
+    ASSERT_EQ(day.getDay(), 30);
+   }
+
+
+  TEST(GregorianDayTest, constructor8)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDay day {GregorianMonth(4), 31};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("day is < 1 or > 30").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, constructor9)
+   {
+    constexpr GregorianDay day {GregorianMonth(2), 28};
+    ASSERT_EQ(day.getDay(), 28);
+   }
+
+
+  TEST(GregorianDayTest, constructor10)
+   {
+    constexpr GregorianDay day {GregorianMonth(GregorianYear(8), 2), 29};
+    ASSERT_EQ(day.getDay(), 29);
+   }
+
+
+  TEST(GregorianDayTest, constructor11)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDay day {GregorianMonth(GregorianYear(9), 2), 29};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("day is < 1 or > 28").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, constructor12)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianDay day {GregorianMonth(GregorianYear(1900), 2), 29};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("day is < 1 or > 28").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, constructor13)
+   {
+    constexpr GregorianDay day {GregorianMonth(GregorianYear(2000), 2), 29};
+    ASSERT_EQ(day.getDay(), 29);
+   }
+
+
+  TEST(GregorianDayTest, tryMake1)
+   {
+    constexpr Expected<GregorianDay> day = GregorianDay::tryMake(31);
+    ASSERT_TRUE(day.hasValue());
+    ASSERT_EQ(day.getValue().getDay(), 31);
+   }
+
+
+  TEST(GregorianDayTest, tryMake2)
+   {
+    constexpr Expected<GregorianDay> day = GregorianDay::tryMake(32);
+    ASSERT_EQ(day.getError(), ValidationError::DayOutOfRange);
+   }
+
+
+  TEST(GregorianDayTest, tryMake3)
+   {
+    constexpr Expected<GregorianDay> day = GregorianDay::tryMake(GregorianMonth(GregorianYear(12), 2), 29);
+    ASSERT_TRUE(day.hasValue());
+    ASSERT_EQ(day.getValue().getDay(), 29);
+   }
+
+
+  TEST(GregorianDayTest, tryMake4)
+   {
+    constexpr Expected<GregorianDay> day = GregorianDay::tryMake(GregorianMonth(GregorianYear(13), 2), 29);
+    ASSERT_EQ(day.getError(), ValidationError::DayOutOfRange);
+   }
+
+
+  TEST(GregorianDayTest, uncheckedConstructor1)
+   {
+    constexpr GregorianDay day {unchecked, 31};
+    ASSERT_EQ(day.getDay(), 31);
+   }
+
+
+  TEST(GregorianDayTest, copyConstructor)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {day1};
+    ASSERT_EQ(day2.getDay(), 12);
+    ASSERT_TRUE(&day1 != &day2);
+   }
+
+
+  TEST(GregorianDayTest, moveConstructor)
+   {
+    GregorianDay day1 {12};
+    const GregorianDay day2 {std::move(day1)};
+    ASSERT_EQ(day2.getDay(), 12);
+   }
+
+
+  TEST(GregorianDayTest, copyAssignment)
+   {
+    const GregorianDay day1 {12};
+    GregorianDay day2 {1};
+    day2 = day1;
+    ASSERT_EQ(day2.getDay(), 12);
+   }
+
+
+  TEST(GregorianDayTest, moveAssignment)
+   {
+    GregorianDay day1 {12};
+    GregorianDay day2 {1};
+    day2 = std::move(day1);
+    ASSERT_EQ(day2.getDay(), 12);
+   }
+
+
+  TEST(GregorianDayTest, equalOperator1)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {12};
+    ASSERT_TRUE(day1 == day2);
+   }
+
+
+  TEST(GregorianDayTest, equalOperator2)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {18};
+    ASSERT_FALSE(day1 == day2);
+   }
+
+
+  TEST(GregorianDayTest, notEqualOperator1)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {18};
+    ASSERT_TRUE(day1 != day2);
+   }
+
+
+  TEST(GregorianDayTest, notEqualOperator2)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {12};
+    ASSERT_FALSE(day1 != day2);
+   }
+
+
+  TEST(GregorianDayTest, smallerOperator1)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {18};
+    ASSERT_TRUE(day1 < day2);
+   }
+
+
+  TEST(GregorianDayTest, smallerOperator2)
+   {
+    constexpr GregorianDay day1 {18};
+    constexpr GregorianDay day2 {12};
+    ASSERT_FALSE(day1 < day2);
+   }
+
+
+  TEST(GregorianDayTest, smallerOperator3)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {12};
+    ASSERT_FALSE(day1 < day2);
+   }
+
+
+  TEST(GregorianDayTest, greaterOperator1)
+   {
+    constexpr GregorianDay day1 {18};
+    constexpr GregorianDay day2 {12};
+    ASSERT_TRUE(day1 > day2);
+   }
+
+
+  TEST(GregorianDayTest, greaterOperator2)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {18};
+    ASSERT_FALSE(day1 > day2);
+   }
+
+
+  TEST(GregorianDayTest, greaterOperator3)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {12};
+    ASSERT_FALSE(day1 > day2);
+   }
+
+
+  TEST(GregorianDayTest, smallerEqualOperator1)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {18};
+    ASSERT_TRUE(day1 <= day2);
+   }
+
+
+  TEST(GregorianDayTest, smallerEqualOperator2)
+   {
+    constexpr GregorianDay day1 {18};
+    constexpr GregorianDay day2 {12};
+    ASSERT_FALSE(day1 <= day2);
+   }
+
+
+  TEST(GregorianDayTest, smallerEqualOperator3)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {12};
+    ASSERT_TRUE(day1 <= day2);
+   }
+
+
+  TEST(GregorianDayTest, greaterEqualOperator1)
+   {
+    constexpr GregorianDay day1 {18};
+    constexpr GregorianDay day2 {12};
+    ASSERT_TRUE(day1 >= day2);
+   }
+
+
+  TEST(GregorianDayTest, greaterEqualOperator2)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {18};
+    ASSERT_FALSE(day1 >= day2);
+   }
+
+
+  TEST(GregorianDayTest, greaterEqualOperator3)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {12};
+    ASSERT_TRUE(day1 >= day2);
+   }
+
+
+  TEST(GregorianDayTest, plusDays1)
+   {
+    constexpr GregorianDay day {12};
+    constexpr Days days {6};
+    constexpr GregorianDay newDay = day + days;
+    ASSERT_EQ(newDay.getDay(), 18);
+   }
+
+
+  TEST(GregorianDayTest, plusDays2)
+   {
+    constexpr GregorianDay day {12};
+    constexpr Days days {20};
+    try
+     {
+      [[maybe_unused]] const GregorianDay newDay = day + days;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("day will be > 31").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, minusDays1)
+   {
+    constexpr GregorianDay day {12};
+    constexpr Days days {6};
+    constexpr GregorianDay newDay = day - days;
+    ASSERT_EQ(newDay.getDay(), 6);
+   }
+
+
+  TEST(GregorianDayTest, minusDays2)
+   {
+    constexpr GregorianDay day {12};
+    constexpr Days days {18};
+    try
+     {
+      [[maybe_unused]] const GregorianDay newDay = day - days;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day will be < 1"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianDayTest, minusDay1)
+   {
+    constexpr GregorianDay day1 {12};
+    constexpr GregorianDay day2 {6};
+    constexpr Days newDays = day1 - day2;
+    ASSERT_EQ(newDays.getDays(), 6);
+   }
+
+
+  TEST(GregorianDayTest, minusDay2)
+   {
+    constexpr GregorianDay day1 {6};
+    constexpr GregorianDay day2 {12};
+    constexpr Days newDays = day1 - day2;
+    ASSERT_EQ(newDays.getDays(), 6);
+   }
+
+
+  TEST(GregorianDayTest, coutDay1)
+   {
+    constexpr GregorianDay day1 {12};
+    testing::internal::CaptureStdout();
+    std::cout << day1;
+    const std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output, "GregorianDay(12)");
+   }
+
+ }
@@ -0,0 +1,439 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <stdexcept>
+#include <utility>
+#include <climits>
+#include <iostream>
+#include "GregorianMonth.h"
+#include "Months.h"
+#include "GregorianYear.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(GregorianMonthTest, constructor1)
+   {
+    constexpr GregorianMonth month {1};
+    ASSERT_EQ(month.getMonth(), 1);
+   }
+
+
+  TEST(GregorianMonthTest, constructor2)
+   {
+    constexpr GregorianMonth month {12};
+    ASSERT_EQ(month.getMonth(), 12);
+   }
+
+
+  TEST(GregorianMonthTest, constructor3)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianMonth month {0};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"month is < 1 or > 12"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianMonthTest, constructor4)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianMonth month {13};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"month is < 1 or > 12"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianMonthTest, constructor5)
+   {
+    const GregorianYear year {8};
+    const GregorianMonth month {year, 1};
+    ASSERT_EQ(month.getMonth(), 1);
+   }
+
+
+  TEST(GregorianMonthTest, constructor6)
+   {
+    try
+     {
+      const GregorianYear year {8};
+      [[maybe_unused]] const GregorianMonth month {year, 0};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"month is < 1 or > 12"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianMonthTest, tryMake1)
+   {
+    constexpr Expected<GregorianMonth> month = GregorianMonth::tryMake(12);
+    ASSERT_TRUE(month.hasValue());
+    ASSERT_EQ(month.getValue().getMonth(), 12);
+   }
+
+
+  TEST(GregorianMonthTest, tryMake2)
+   {
+    constexpr Expected<GregorianMonth> month = GregorianMonth::tryMake(0);
+    ASSERT_FALSE(month.hasValue());
+    ASSERT_EQ(month.getError(), ValidationError::MonthOutOfRange);
+   }
+
+
+  TEST(GregorianMonthTest, tryMake3)
+   {
+    constexpr Expected<GregorianMonth> month = GregorianMonth::tryMake(GregorianYear(12), 2);
+    ASSERT_TRUE(month.hasValue());
+    ASSERT_EQ(month.getValue().getDaysInMonth().getDays(), 29);
+   }
+
+
+  TEST(GregorianMonthTest, tryMake4)
+   {
+    constexpr Expected<GregorianMonth> month = GregorianMonth::tryMake(GregorianYear(12), 13);
+    ASSERT_EQ(month.getError(), ValidationError::MonthOutOfRange);
+   }
+
+
+  TEST(GregorianMonthTest, uncheckedConstructor1)
+   {
+    constexpr GregorianMonth month {unchecked, 12};
+    ASSERT_EQ(month.getMonth(), 12);
+   }
+
+
+  TEST(GregorianMonthTest, uncheckedConstructor2)
+   {
+    constexpr GregorianMonth month {unchecked, GregorianYear(12), 2};
+    ASSERT_EQ(month.getDaysInMonth().getDays(), 29);
+   }
+
+
+  TEST(GregorianMonthTest, copyConstructor)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {month1};
+    ASSERT_EQ(month2.getMonth(), 6);
+    ASSERT_TRUE(&month1 != &month2);
+   }
+
+
+  TEST(GregorianMonthTest, moveConstructor)
+   {
+    GregorianMonth month1 {12};
+    const GregorianMonth month2 {std::move(month1)};
+    ASSERT_EQ(month2.getMonth(), 12);
+   }
+
+
+  TEST(GregorianMonthTest, copyAssignment)
+   {
+    const GregorianMonth month1 {12};
+    GregorianMonth month2 {1};
+    month2 = month1;
+    ASSERT_EQ(month2.getMonth(), 12);
+   }
+
+
+  TEST(GregorianMonthTest, moveAssignment)
+   {
+    GregorianMonth month1 {12};
+    GregorianMonth month2 {1};
+    month2 = std::move(month1);
+    ASSERT_EQ(month2.getMonth(), 12);
+   }
+
+
+  TEST(GregorianMonthTest, getMonth)
+   {
+    constexpr GregorianMonth month1 {12};
+    ASSERT_EQ(month1.getMonth(), 12);
+   }
+
+
+  TEST(GregorianMonthTest, getDaysInMonth1)
+   {
+    constexpr GregorianMonth month1 {1};
+    ASSERT_EQ(month1.getDaysInMonth().getDays(), 31);
+   }
+
+
+  TEST(GregorianMonthTest, getDaysInMonth2)
+   {
+    constexpr GregorianMonth month1 {4};
+    ASSERT_EQ(month1.getDaysInMonth().getDays(), 30);
+   }
+
+
+  TEST(GregorianMonthTest, getDaysInMonth3)
+   {
+    constexpr GregorianMonth month1 {2};
+    ASSERT_EQ(month1.getDaysInMonth().getDays(), 28);
+   }
+
+
+  TEST(GregorianMonthTest, getDaysInMonth4)
+   {
+    constexpr GregorianMonth month1 {GregorianYear(8), 2};
+    ASSERT_EQ(month1.getDaysInMonth().getDays(), 29);
+   }
+
+
+  TEST(GregorianMonthTest, equalOperator1)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_TRUE(month1 == month2);
+   }
+
+
+  TEST(GregorianMonthTest, equalOperator2)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {8};
+    ASSERT_FALSE(month1 == month2);
+   }
+
+
+  TEST(GregorianMonthTest, notEqualOperator1)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {8};
+    ASSERT_TRUE(month1 != month2);
+   }
+
+
+  TEST(GregorianMonthTest, notEqualOperator2)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_FALSE(month1 != month2);
+   }
+
+
+  TEST(GregorianMonthTest, smallerOperator1)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {8};
+    ASSERT_TRUE(month1 < month2);
+   }
+
+
+  TEST(GregorianMonthTest, smallerOperator2)
+   {
+    constexpr GregorianMonth month1 {8};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_FALSE(month1 < month2);
+   }
+
+
+  TEST(GregorianMonthTest, smallerOperator3)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_FALSE(month1 < month2);
+   }
+
+
+  TEST(GregorianMonthTest, greaterOperator1)
+   {
+    constexpr GregorianMonth month1 {8};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_TRUE(month1 > month2);
+   }
+
+
+  TEST(GregorianMonthTest, greaterOperator2)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {8};
+    ASSERT_FALSE(month1 > month2);
+   }
+
+
+  TEST(GregorianMonthTest, greaterOperator3)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_FALSE(month1 > month2);
+   }
+
+
+  TEST(GregorianMonthTest, smallerEqualOperator1)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {8};
+    ASSERT_TRUE(month1 <= month2);
+   }
+
+
+  TEST(GregorianMonthTest, smallerEqualOperator2)
+   {
+    constexpr GregorianMonth month1 {8};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_FALSE(month1 <= month2);
+   }
+
+
+  TEST(GregorianMonthTest, smallerEqualOperator3)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_TRUE(month1 <= month2);
+   }
+
+
+  TEST(GregorianMonthTest, greaterEqualOperator1)
+   {
+    constexpr GregorianMonth month1 {8};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_TRUE(month1 >= month2);
+   }
+
+
+  TEST(GregorianMonthTest, greaterEqualOperator2)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {8};
+    ASSERT_FALSE(month1 >= month2);
+   }
+
+
+  TEST(GregorianMonthTest, greaterEqualOperator3)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {6};
+    ASSERT_TRUE(month1 >= month2);
+   }
+
+
+  TEST(GregorianMonthTest, plusMonths1)
+   {
+    constexpr GregorianMonth month {6};
+    constexpr Months months {2};
+    constexpr GregorianMonth newMonth = month + months;
+    ASSERT_EQ(newMonth.getMonth(), 8);
+   }
+
+
+  TEST(GregorianMonthTest, plusMonths2)
+   {
+    constexpr GregorianMonth month {3};
+    constexpr Months months {10};
+    try
+     {
+      [[maybe_unused]] const GregorianMonth newMonth = month + months;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"month will be > 12"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianMonthTest, plusMonths3)
+   {
+    constexpr GregorianMonth month {10};
+    constexpr Months months {ULONG_MAX - 5};
+    try
+     {
+      [[maybe_unused]] const GregorianMonth newMonth = month + months;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"month will be > 12"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianMonthTest, minusMonths1)
+   {
+    constexpr GregorianMonth month {6};
+    constexpr Months months {2};
+    constexpr GregorianMonth newMonth = month - months;
+    ASSERT_EQ(newMonth.getMonth(), 4);
+   }
+
+
+  TEST(GregorianMonthTest, minusMonths2)
+   {
+    constexpr GregorianMonth month {6};
+    constexpr Months months {8};
+    try
+     {
+      [[maybe_unused]] const GregorianMonth newMonth = month - months;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("month will be < 1").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianMonthTest, minusMonths3)
+   {
+    constexpr GregorianMonth month {10};
+    constexpr Months months {ULONG_MAX};
+    try
+     {
+      [[maybe_unused]] const GregorianMonth newMonth = month - months;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("month will be < 1").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianMonthTest, minusMonth1)
+   {
+    constexpr GregorianMonth month1 {12};
+    constexpr GregorianMonth month2 {6};
+    constexpr Months newMonths = month1 - month2;
+    ASSERT_EQ(newMonths.getMonths(), 6);
+   }
+
+
+  TEST(GregorianMonthTest, minusMonth2)
+   {
+    constexpr GregorianMonth month1 {6};
+    constexpr GregorianMonth month2 {12};
+    constexpr Months newMonths = month1 - month2;
+    ASSERT_EQ(newMonths.getMonths(), 6);
+   }
+
+
+  TEST(GregorianMonthTest, coutMonth1)
+   {
+    constexpr GregorianMonth month1 {12};
+    testing::internal::CaptureStdout();
+    std::cout << month1;
+    const std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output, "GregorianMonth(12)");
+   }
+
+ }
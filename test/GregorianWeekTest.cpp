@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <stdexcept>
+#include <utility>
+#include <iostream>
+#include "GregorianWeek.h"
+#include "GregorianYear.h"
+#include "Weeks.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(GregorianWeekTest, constructor1)
+   {
+    constexpr GregorianWeek week {1};
+    ASSERT_EQ(week.getWeek(), 1);
+   }
+
+
+  TEST(GregorianWeekTest, constructor2)
+   {
+    constexpr GregorianWeek week {53};
+    ASSERT_EQ(week.getWeek(), 53);
+   }
+
+
+ TEST(GregorianWeekTest, constructor3)
+  {
+   try
+    {
+     [[maybe_unused]] const GregorianWeek week {0};
+     FAIL();
+    }
+   catch (const std::out_of_range& e)
+    {
+     ASSERT_EQ(std::string{"week is < 1 or > 53"}.compare(e.what()), 0);
+    }
+  }
+
+
+ TEST(GregorianWeekTest, constructor4)
+  {
+   try
+    {
+     [[maybe_unused]] const GregorianWeek week {54};
+     FAIL();
+    }
+   catch (const std::out_of_range& e)
+    {
+     ASSERT_EQ(std::string{"week is < 1 or > 53"}.compare(e.what()), 0);
+    }
+  }
+
+
+ TEST(GregorianWeekTest, constructor5)
+  {
+   constexpr GregorianWeek week {53, GregorianYear(2015)};
+   ASSERT_EQ(week.getWeek(), 53);
+  }
+
+
+ TEST(GregorianWeekTest, constructor6)
+  {
+   try
+    {
+     [[maybe_unused]] const GregorianWeek week {53, GregorianYear(2021)};
+     FAIL();
+    }
+   catch (const std::out_of_range& e)
+    {
+     ASSERT_EQ(std::string{"week is < 1 or > 52"}.compare(e.what()), 0);
+    }
+  }
+
+
+  TEST(GregorianWeekTest, tryMake1)
+   {
+    constexpr Expected<GregorianWeek> week = GregorianWeek::tryMake(53);
+    ASSERT_TRUE(week.hasValue());
+    ASSERT_EQ(week.getValue().getWeek(), 53);
+   }
+
+
+  TEST(GregorianWeekTest, tryMake2)
+   {
+    constexpr Expected<GregorianWeek> week = GregorianWeek::tryMake(54);
+    ASSERT_EQ(week.getError(), ValidationError::WeekOutOfRange);
+   }
+
+
+  TEST(GregorianWeekTest, tryMake3)
+   {
+    constexpr Expected<GregorianWeek> week = GregorianWeek::tryMake(53, GregorianYear(2015));
+    ASSERT_TRUE(week.hasValue());
+    ASSERT_EQ(week.getValue().getMaxWeeks(), 53);
+   }
+
+
+  TEST(GregorianWeekTest, tryMake4)
+   {
+    constexpr Expected<GregorianWeek> week = GregorianWeek::tryMake(53, GregorianYear(2021));
+    ASSERT_EQ(week.getError(), ValidationError::WeekOutOfRange);
+   }
+
+
+  TEST(GregorianWeekTest, uncheckedConstructor1)
+   {
+    constexpr GregorianWeek week {unchecked, 53};
+    ASSERT_EQ(week.getWeek(), 53);
+   }
+
+
+  TEST(GregorianWeekTest, uncheckedConstructor2)
+   {
+    constexpr GregorianWeek week {unchecked, 52, GregorianYear(2021)};
+    ASSERT_EQ(week.getMaxWeeks(), 52);
+   }
+
+
+ TEST(GregorianWeekTest, copyConstructor)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {week1};
+   ASSERT_EQ(week2.getWeek(), 12);
+   ASSERT_TRUE(&week1 != &week2);
+  }
+
+
+  TEST(GregorianWeekTest, moveConstructor)
+   {
+    GregorianWeek week1 {12};
+    const GregorianWeek week2 {std::move(week1)};
+    ASSERT_EQ(week2.getWeek(), 12);
+   }
+
+
+  TEST(GregorianWeekTest, copyAssignment)
+   {
+    const GregorianWeek week1 {12};
+    GregorianWeek week2 {1};
+    week2 = week1;
+    ASSERT_EQ(week2.getWeek(), 12);
+   }
+
+
+  TEST(GregorianWeekTest, moveAssignment)
+   {
+    GregorianWeek week1 {12};
+    GregorianWeek week2 {1};
+    week2 = std::move(week1);
+    ASSERT_EQ(week2.getWeek(), 12);
+   }
+
+
+ TEST(GregorianWeekTest, getMaxWeeks1)
+  {
+   constexpr GregorianWeek week {53, GregorianYear(2015)};
+   ASSERT_EQ(week.getMaxWeeks(), 53);
+  }
+
+
+ TEST(GregorianWeekTest, getMaxWeeks2)
+  {
+   constexpr GregorianWeek week {52, GregorianYear(2021)};
+   ASSERT_EQ(week.getMaxWeeks(), 52);
+  }
+
+
+ TEST(GregorianWeekTest, equalOperator1)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_TRUE(week1 == week2);
+  }
+
+
+ TEST(GregorianWeekTest, equalOperator2)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {18};
+   ASSERT_FALSE(week1 == week2);
+  }
+
+
+ TEST(GregorianWeekTest, notEqualOperator1)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {18};
+   ASSERT_TRUE(week1 != week2);
+  }
+
+
+ TEST(GregorianWeekTest, notEqualOperator2)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_FALSE(week1 != week2);
+  }
+
+
+ TEST(GregorianWeekTest, smallerOperator1)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {18};
+   ASSERT_TRUE(week1 < week2);
+  }
+
+
+ TEST(GregorianWeekTest, smallerOperator2)
+  {
+   constexpr GregorianWeek week1 {18};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_FALSE(week1 < week2);
+  }
+
+
+ TEST(GregorianWeekTest, smallerOperator3)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_FALSE(week1 < week2);
+  }
+
+
+ TEST(GregorianWeekTest, greaterOperator1)
+  {
+   constexpr GregorianWeek week1 {18};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_TRUE(week1 > week2);
+  }
+
+
+ TEST(GregorianWeekTest, greaterOperator2)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {18};
+   ASSERT_FALSE(week1 > week2);
+  }
+
+
+ TEST(GregorianWeekTest, greaterOperator3)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_FALSE(week1 > week2);
+  }
+
+
+ TEST(GregorianWeekTest, smallerEqualOperator1)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {18};
+   ASSERT_TRUE(week1 <= week2);
+  }
+
+
+ TEST(GregorianWeekTest, smallerEqualOperator2)
+  {
+   constexpr GregorianWeek week1 {18};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_FALSE(week1 <= week2);
+  }
+
+
+ TEST(GregorianWeekTest, smallerEqualOperator3)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_TRUE(week1 <= week2);
+  }
+
+
+ TEST(GregorianWeekTest, greaterEqualOperator1)
+  {
+   constexpr GregorianWeek week1 {18};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_TRUE(week1 >= week2);
+  }
+
+
+ TEST(GregorianWeekTest, greaterEqualOperator2)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {18};
+   ASSERT_FALSE(week1 >= week2);
+  }
+
+
+ TEST(GregorianWeekTest, greaterEqualOperator3)
+  {
+   constexpr GregorianWeek week1 {12};
+   constexpr GregorianWeek week2 {12};
+   ASSERT_TRUE(week1 >= week2);
+  }
+
+
+ TEST(GregorianWeekTest, plusWeeks1)
+  {
+   constexpr GregorianWeek week {12};
+   constexpr Weeks weeks {6};
+   constexpr GregorianWeek newWeek = week + weeks;
+   ASSERT_EQ(newWeek.getWeek(), 18);
+  }
+
+
+ TEST(GregorianWeekTest, plusWeeks2)
+  {
+   constexpr GregorianWeek week {12};
+   constexpr Weeks weeks {42};
+   try
+    {
+     [[maybe_unused]] const GregorianWeek newWeek = week + weeks;
+     FAIL();
+    }
+   catch(const std::out_of_range& e)
+    {
+     ASSERT_EQ(std::string{"week will be > 53"}.compare(e.what()), 0);
+    }
+  }
+
+
+ TEST(GregorianWeekTest, minusWeeks1)
+  {
+   constexpr GregorianWeek week {12};
+   constexpr Weeks weeks {6};
+   constexpr GregorianWeek newWeek = week - weeks;
+   ASSERT_EQ(newWeek.getWeek(), 6);
+  }
+
+
+ TEST(GregorianWeekTest, minusWeeks2)
+  {
+   constexpr GregorianWeek week {12};
+   constexpr Weeks weeks {18};
+   try
+    {
+     [[maybe_unused]] const GregorianWeek newWeek = week - weeks;
+     FAIL();
+    }
+   catch(const std::out_of_range& e)
+    {
+     ASSERT_EQ(std::string("week will be < 1").compare(e.what()), 0);
+    }
+  }
+
+
+  TEST(GregorianWeekTest, minusWeek1)
+   {
+    constexpr GregorianWeek week1 {12};
+    constexpr GregorianWeek week2 {6};
+    constexpr Weeks newWeeks = week1 - week2;
+    ASSERT_EQ(newWeeks.getWeeks(), 6);
+   }
+
+
+  TEST(GregorianWeekTest, minusWeek2)
+   {
+    constexpr GregorianWeek week1 {6};
+    constexpr GregorianWeek week2 {12};
+    constexpr Weeks newWeeks = week1 - week2;
+    ASSERT_EQ(newWeeks.getWeeks(), 6);
+   }
+
+
+  TEST(GregorianWeekTest, coutWeek1)
+   {
+    constexpr GregorianWeek week1 {12};
+    testing::internal::CaptureStdout();
+    std::cout << week1;
+    const std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output, "GregorianWeek(12)");
+   }
+
+ } // namespace
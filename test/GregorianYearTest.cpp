@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <stdexcept>
+#include <utility>
+#include <iostream>
+#include <climits>
+#include "GregorianYear.h"
+#include "Years.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(GregorianYearTest, constructor1)
+   {
+    constexpr GregorianYear year {1};
+    ASSERT_EQ(year.getYear(), 1);
+   }
+
+
+  TEST(GregorianYearTest, constructor2)
+   {
+    constexpr GregorianYear year {32767};
+    ASSERT_EQ(year.getYear(), 32767);
+   }
+
+
+  TEST(GregorianYearTest, constructor3)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianYear year {0};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"year is < 1 or > 32767"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianYearTest, constructor4)
+   {
+    try
+     {
+      [[maybe_unused]] const GregorianYear year {32768};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"year is < 1 or > 32767"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianYearTest, tryMake1)
+   {
+    constexpr Expected<GregorianYear> year = GregorianYear::tryMake(1);
+    ASSERT_TRUE(year.hasValue());
+    ASSERT_EQ(year.getValue().getYear(), 1);
+   }
+
+
+  TEST(GregorianYearTest, tryMake2)
+   {
+    constexpr Expected<GregorianYear> year = GregorianYear::tryMake(0);
+    ASSERT_FALSE(year.hasValue());
+    ASSERT_EQ(year.getError(), ValidationError::YearOutOfRange);
+   }
+
+
+  TEST(GregorianYearTest, uncheckedConstructor1)
+   {
+    constexpr GregorianYear year {unchecked, 32767};
+    ASSERT_EQ(year.getYear(), 32767);
+   }
+
+
+  TEST(GregorianYearTest, copyConstructor)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {year1};
+    ASSERT_EQ(year2.getYear(), 12);
+    ASSERT_TRUE(&year1 != &year2);
+   }
+
+
+  TEST(GregorianYearTest, moveConstructor)
+   {
+    GregorianYear year1 {12};
+    const GregorianYear year2 {std::move(year1)};
+    ASSERT_EQ(year2.getYear(), 12);
+   }
+
+
+  TEST(GregorianYearTest, copyAssignment)
+   {
+    const GregorianYear year1 {12};
+    GregorianYear year2 {8};
+    year2 = year1;
+    ASSERT_EQ(year2.getYear(), 12);
+   }
+
+
+  TEST(GregorianYearTest, moveAssignment)
+   {
+    GregorianYear year1 {12};
+    GregorianYear year2 {8};
+    year2 = std::move(year1);
+    ASSERT_EQ(year2.getYear(), 12);
+   }
+
+
+  TEST(GregorianYearTest, isLeapYear1)
+   {
+    constexpr GregorianYear year {8};
+    ASSERT_TRUE(year.isLeapYear());
+   }
+
+
+  TEST(GregorianYearTest, isLeapYear2)
+   {
+    constexpr GregorianYear year {9};
+    ASSERT_FALSE(year.isLeapYear());
+   }
+
+
+  TEST(GregorianYearTest, isLeapYear3)
+   {
+    constexpr GregorianYear year {1900};
+    ASSERT_FALSE(year.isLeapYear());
+   }
+
+
+  TEST(GregorianYearTest, isLeapYear4)
+   {
+    constexpr GregorianYear year {2000};
+    ASSERT_TRUE(year.isLeapYear());
+   }
+
+
+  TEST(GregorianYearTest, getDaysInYear1)
+   {
+    constexpr GregorianYear year {8};
+    ASSERT_EQ(year.getDaysInYear().getDays(), 366);
+   }
+
+
+  TEST(GregorianYearTest, getDaysInYear2)
+   {
+    constexpr GregorianYear year {9};
+    ASSERT_EQ(year.getDaysInYear().getDays(), 365);
+   }
+
+
+  TEST(GregorianYearTest, getWeeksInYear1)
+   {
+    constexpr GregorianYear year {2021};
+    ASSERT_EQ(year.getWeeksInYear().getWeeks(), 52);
+   }
+
+
+  TEST(GregorianYearTest, getWeeksInYear2)
+   {
+    constexpr GregorianYear year {2015};
+    ASSERT_EQ(year.getWeeksInYear().getWeeks(), 53);
+   }
+
+
+  TEST(GregorianYearTest, getWeeksInYear3)
+   {
+    constexpr GregorianYear year {2020};
+    ASSERT_EQ(year.getWeeksInYear().getWeeks(), 53);
+   }
+
+
+  TEST(GregorianYearTest, equalOperator1)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {12};
+    ASSERT_TRUE(year1 == year2);
+   }
+
+
+  TEST(GregorianYearTest, equalOperator2)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {18};
+    ASSERT_FALSE(year1 == year2);
+   }
+
+
+  TEST(GregorianYearTest, notEqualOperator1)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {18};
+    ASSERT_TRUE(year1 != year2);
+   }
+
+
+  TEST(GregorianYearTest, notEqualOperator2)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {12};
+    ASSERT_FALSE(year1 != year2);
+   }
+
+
+  TEST(GregorianYearTest, smallerOperator1)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {18};
+    ASSERT_TRUE(year1 < year2);
+   }
+
+
+  TEST(GregorianYearTest, smallerOperator2)
+   {
+    constexpr GregorianYear year1 {18};
+    constexpr GregorianYear year2 {12};
+    ASSERT_FALSE(year1 < year2);
+   }
+
+
+  TEST(GregorianYearTest, smallerOperator3)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {12};
+    ASSERT_FALSE(year1 < year2);
+   }
+
+
+  TEST(GregorianYearTest, greaterOperator1)
+   {
+    constexpr GregorianYear year1 {18};
+    constexpr GregorianYear year2 {12};
+    ASSERT_TRUE(year1 > year2);
+   }
+
+
+  TEST(GregorianYearTest, greaterOperator2)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {18};
+    ASSERT_FALSE(year1 > year2);
+   }
+
+
+  TEST(GregorianYearTest, greaterOperator3)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {12};
+    ASSERT_FALSE(year1 > year2);
+   }
+
+
+  TEST(GregorianYearTest, smallerEqualOperator1)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {18};
+    ASSERT_TRUE(year1 <= year2);
+   }
+
+
+  TEST(GregorianYearTest, smallerEqualOperator2)
+   {
+    constexpr GregorianYear year1 {18};
+    constexpr GregorianYear year2 {12};
+    ASSERT_FALSE(year1 <= year2);
+   }
+
+
+  TEST(GregorianYearTest, smallerEqualOperator3)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {12};
+    ASSERT_TRUE(year1 <= year2);
+   }
+
+
+  TEST(GregorianYearTest, greaterEqualOperator1)
+   {
+    constexpr GregorianYear year1 {18};
+    constexpr GregorianYear year2 {12};
+    ASSERT_TRUE(year1 >= year2);
+   }
+
+
+  TEST(GregorianYearTest, greaterEqualOperator2)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {18};
+    ASSERT_FALSE(year1 >= year2);
+   }
+
+
+  TEST(GregorianYearTest, greaterEqualOperator3)
+   {
+    constexpr GregorianYear year1 {12};
+    constexpr GregorianYear year2 {12};
+    ASSERT_TRUE(year1 >= year2);
+   }
+
+
+  TEST(GregorianYearTest, plusYears1)
+   {
+    constexpr GregorianYear year {12};
+    constexpr Years years {6};
+    constexpr GregorianYear newYear = year + years;
+    ASSERT_EQ(newYear.getYear(), 18);
+   }
+
+
+  TEST(GregorianYearTest, plusYears2)
+   {
+    constexpr GregorianYear year {32000};
+    constexpr Years years {768};
+    try
+     {
+      [[maybe_unused]] const GregorianYear newYear = year + years;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"year will be > 32767"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianYearTest, plusYears3)
+   {
+    constexpr GregorianYear year {32000};
+    constexpr Years years {LONG_MAX};
+    try
+     {
+      [[maybe_unused]] const GregorianYear newYear = year + years;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"year will be > LONG_MAX"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianYearTest, minusYears1)
+   {
+    constexpr GregorianYear year {18};
+    constexpr Years years {6};
+    constexpr GregorianYear newYear = year - years;
+    ASSERT_EQ(newYear.getYear(), 12);
+   }
+
+
+  TEST(GregorianYearTest, minusYears2)
+   {
+    constexpr GregorianYear year {12};
+    constexpr Years years {12};
+    try
+     {
+      [[maybe_unused]] const GregorianYear newYear = year - years;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"year will be < 1"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianYearTest, minusYears3)
+   {
+    constexpr GregorianYear year {12};
+    constexpr Years years {13};
+    try
+     {
+      [[maybe_unused]] const GregorianYear newYear = year - years;
+      FAIL();
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"year will be < 0"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(GregorianYearTest, minusYear1)
+   {
+    constexpr GregorianYear year1 {18};
+    constexpr GregorianYear year2 {8};
+    constexpr Years newYears = year1 - year2;
+    ASSERT_EQ(newYears.getYears(), 10);
+   }
+
+
+  TEST(GregorianYearTest, minusYear2)
+   {
+    constexpr GregorianYear year1 {8};
+    constexpr GregorianYear year2 {18};
+    constexpr Years newYears = year1 - year2;
+    ASSERT_EQ(newYears.getYears(), 10);
+   }
+
+
+  TEST(GregorianYearTest, coutYear1)
+   {
+    constexpr GregorianYear year1 {12};
+    testing::internal::CaptureStdout();
+    std::cout << year1;
+    const std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output, "GregorianYear(12)");
+   }
+
+ } // namespace DateLib
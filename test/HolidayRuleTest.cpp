@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "HolidayRule.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(HolidayRuleTest, fixed1)
+   {
+    constexpr HolidayRule rule = HolidayRule::fixed(JulianMonth(12), JulianDay(25));
+    ASSERT_EQ(rule.getKind(), HolidayKind::Fixed);
+    ASSERT_EQ(rule.getDayWithinYear(2023), 359);
+    ASSERT_EQ(rule.getDayWithinYear(2024), 360);
+   }
+
+
+  TEST(HolidayRuleTest, fixed2)
+   {
+    constexpr HolidayRule rule = HolidayRule::fixed(JulianMonth(2), JulianDay(29));
+    ASSERT_EQ(rule.getDayWithinYear(2023), 0);
+    ASSERT_EQ(rule.getDayWithinYear(2024), 60);
+   }
+
+
+  TEST(HolidayRuleTest, fixed3)
+   {
+    try
+     {
+      [[maybe_unused]] const HolidayRule rule = HolidayRule::fixed(JulianMonth(4), JulianDay(31));
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day is > 30"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(HolidayRuleTest, nthWeekday1)
+   {
+    // January 1st 2024 is a sunday
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(1), Weekdays::Monday, 1).getDayWithinYear(2024), 2);
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(1), Weekdays::Sunday, 1).getDayWithinYear(2024), 1);
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(1), Weekdays::Monday, 5).getDayWithinYear(2024), 30);
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(1), Weekdays::Monday, -1).getDayWithinYear(2024), 30);
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(1), Weekdays::Wednesday, -1).getDayWithinYear(2024), 25);
+   }
+
+
+  TEST(HolidayRuleTest, nthWeekday2)
+   {
+    // February 2024 has four mondays (6, 13, 20, 27)
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(2), Weekdays::Monday, 5).getDayWithinYear(2024), 0);
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(2), Weekdays::Monday, -4).getDayWithinYear(2024), 37);
+    ASSERT_EQ(HolidayRule::nthWeekday(JulianMonth(2), Weekdays::Monday, -5).getDayWithinYear(2024), 0);
+   }
+
+
+  TEST(HolidayRuleTest, nthWeekday3)
+   {
+    try
+     {
+      [[maybe_unused]] const HolidayRule rule = HolidayRule::nthWeekday(JulianMonth(1), Weekdays::Monday, 6);
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"ordinal is 0 or < -5 or > 5"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(HolidayRuleTest, easter1)
+   {
+    // Easter sunday 2024 is april 22nd (day 113)
+    ASSERT_EQ(HolidayRule::easter(0).getDayWithinYear(2024), 113);
+    ASSERT_EQ(HolidayRule::easter(-2).getDayWithinYear(2024), 111);
+    ASSERT_EQ(HolidayRule::easter(49).getDayWithinYear(2024), 162);
+    ASSERT_EQ(HolidayRule::easter(-113).getDayWithinYear(2024), 0);
+    ASSERT_EQ(HolidayRule::easter(254).getDayWithinYear(2024), 0);
+   }
+
+
+  TEST(HolidayRuleTest, easter2)
+   {
+    try
+     {
+      [[maybe_unused]] const HolidayRule rule = HolidayRule::easter(367);
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"offset is < -366 or > 366"}.compare(e.what()), 0);
+     }
+   }
+
+ }
@@ -49,6 +49,24 @@ namespace
    }
 
 
+  TEST(JDTest, copyAssignment)
+   {
+    const JD jd1 {12};
+    JD jd2 {1};
+    jd2 = jd1;
+    ASSERT_EQ(jd2.getJD(), 12);
+   }
+
+
+  TEST(JDTest, moveAssignment)
+   {
+    JD jd1 {12};
+    JD jd2 {1};
+    jd2 = std::move(jd1);
+    ASSERT_EQ(jd2.getJD(), 12);
+   }
+
+
   TEST(JDTest, equalOperator1)
    {
     constexpr JD jd1 {12};
@@ -245,6 +263,13 @@ namespace
    }
 
 
+  TEST(JDTest, getWeekday1)
+   {
+    constexpr JD jd {2460000};
+    ASSERT_EQ(jd.getWeekday(), Weekdays::Friday);
+   }
+
+
   TEST(JDTest, coutJD1)
    {
     constexpr JD jd1 {12};
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "JulianDateRange.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(JulianDateRangeTest, days1)
+   {
+    const JulianDate first {JulianYear(2024), JulianMonth(1), JulianDay(1)};
+    const JulianDate last {JulianYear(2024), JulianMonth(12), JulianDay(31)};
+    const JulianDateRange range {first, last};
+    ASSERT_EQ(range.size(), 366);
+    unsigned long jd = first.getJD().getJD();
+    std::size_t count = 0;
+    for (auto iter = range.begin(); iter != range.end(); ++iter)
+     {
+      const JulianDate date = *iter;
+      ASSERT_EQ(date, JulianDate(JD(jd)));
+      ASSERT_EQ(iter.getJD().getJD(), jd);
+      ASSERT_EQ(iter.getWeekday(), date.getWeekday());
+      ++jd;
+      ++count;
+     }
+    ASSERT_EQ(count, 366);
+   }
+
+
+  TEST(JulianDateRangeTest, days2)
+   {
+    const JulianDate first {JulianYear(2024), JulianMonth(1), JulianDay(2)};
+    const JulianDate last {JulianYear(2024), JulianMonth(1), JulianDay(1)};
+    const JulianDateRange range {first, last};
+    ASSERT_TRUE(range.empty());
+    ASSERT_EQ(range.begin(), range.end());
+   }
+
+
+  TEST(JulianDateRangeTest, days3)
+   {
+    const JulianDate first {JulianYear(2000), JulianMonth(1), JulianDay(31)};
+    const JulianDate last {JulianYear(2010), JulianMonth(12), JulianDay(31)};
+    for (unsigned long step = 1; step <= 100; ++step)
+     {
+      const JulianDateRange range {first, last, Days(step)};
+      unsigned long jd = first.getJD().getJD();
+      std::size_t count = 0;
+      for (auto iter = range.begin(); iter != range.end(); ++iter)
+       {
+        ASSERT_EQ(*iter, JulianDate(JD(jd)));
+        ASSERT_EQ(iter.getWeekday(), JD(jd).getWeekday());
+        jd += step;
+        ++count;
+       }
+      ASSERT_EQ(count, range.size());
+      ASSERT_GT(jd, last.getJD().getJD());
+      ASSERT_LE(jd - step, last.getJD().getJD());
+     }
+   }
+
+
+  TEST(JulianDateRangeTest, days4)
+   {
+    const JulianDate first {JulianYear(32767), JulianMonth(12), JulianDay(29)};
+    const JulianDate last {JulianYear(32767), JulianMonth(12), JulianDay(31)};
+    std::vector<JulianDate> dates;
+    for (const JulianDate date : JulianDateRange(first, last))
+     {
+      dates.push_back(date);
+     }
+    ASSERT_EQ(dates.size(), 3);
+    ASSERT_EQ(dates.back(), last);
+   }
+
+
+  TEST(JulianDateRangeTest, days5)
+   {
+    try
+     {
+      const JulianDate first {JulianYear(2024), JulianMonth(1), JulianDay(1)};
+      const JulianDateRange range {first, first, Days(0)};
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"step is 0"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(JulianDateRangeTest, weeks1)
+   {
+    const JulianDate first {JulianYear(2024), JulianMonth(1), JulianDay(1)};
+    const JulianDate last {JulianYear(2024), JulianMonth(12), JulianDay(31)};
+    const JulianDateRange range {first, last, Weeks(2)};
+    ASSERT_EQ(range.size(), 27);
+    for (auto iter = range.begin(); iter != range.end(); ++iter)
+     {
+      ASSERT_EQ(iter.getWeekday(), first.getWeekday());
+      ASSERT_EQ((*iter).getWeekday(), first.getWeekday());
+     }
+   }
+
+
+  TEST(JulianDateRangeTest, weeks2)
+   {
+    const JulianDate first {JulianYear(2024), JulianMonth(1), JulianDay(1)};
+    const JulianDateRange range {first, first, Weeks(ULONG_MAX)};
+    ASSERT_EQ(range.size(), 1);
+    ASSERT_EQ(*range.begin(), first);
+   }
+
+
+  TEST(JulianDateRangeTest, months1)
+   {
+    const JulianDate first {JulianYear(2024), JulianMonth(1), JulianDay(31)};
+    const JulianDate last {JulianYear(2024), JulianMonth(5), JulianDay(31)};
+    std::vector<JulianDate> dates;
+    for (const JulianDate date : JulianDateRange(first, last, Months(1)))
+     {
+      dates.push_back(date);
+     }
+    const std::vector<JulianDate> expected {first, JulianDate(JulianYear(2024), JulianMonth(2), JulianDay(29)), JulianDate(JulianYear(2024), JulianMonth(3), JulianDay(31)), JulianDate(JulianYear(2024), JulianMonth(4), JulianDay(30)), last};
+    ASSERT_EQ(dates, expected);
+   }
+
+
+  TEST(JulianDateRangeTest, months2)
+   {
+    const JulianDate first {JulianYear(2023), JulianMonth(2), JulianDay(28)};
+    const JulianDate last {JulianYear(2023), JulianMonth(4), JulianDay(30)};
+    const JulianDateRange clamp {first, last, Months(1)};
+    const JulianDateRange stick {first, last, Months(1), MonthEndRule::Stick};
+    ASSERT_EQ(clamp.size(), 3);
+    ASSERT_EQ(stick.size(), 3);
+    auto iter = clamp.begin();
+    ++iter;
+    ASSERT_EQ(*iter, JulianDate(JulianYear(2023), JulianMonth(3), JulianDay(28)));
+    iter = stick.begin();
+    ++iter;
+    ASSERT_EQ(*iter, JulianDate(JulianYear(2023), JulianMonth(3), JulianDay(31)));
+    ASSERT_EQ(iter.getJD(), JulianDate(JulianYear(2023), JulianMonth(3), JulianDay(31)).getJD());
+    ASSERT_EQ(iter.getWeekday(), JulianDate(JulianYear(2023), JulianMonth(3), JulianDay(31)).getWeekday());
+    ++iter;
+    ASSERT_EQ(*iter, last);
+   }
+
+
+  TEST(JulianDateRangeTest, months3)
+   {
+    const JulianDate first {JulianYear(2023), JulianMonth(1), JulianDay(31)};
+    ASSERT_EQ(JulianDateRange(first, JulianDate(JulianYear(2023), JulianMonth(2), JulianDay(28)), Months(1)).size(), 2);
+    ASSERT_EQ(JulianDateRange(first, JulianDate(JulianYear(2023), JulianMonth(2), JulianDay(27)), Months(1)).size(), 1);
+    ASSERT_EQ(JulianDateRange(first, JulianDate(JulianYear(2023), JulianMonth(3), JulianDay(30)), Months(1)).size(), 2);
+    ASSERT_EQ(JulianDateRange(first, JulianDate(JulianYear(2024), JulianMonth(1), JulianDay(31)), Months(3)).size(), 5);
+   }
+
+
+  TEST(JulianDateRangeTest, years1)
+   {
+    const JulianDate first {JulianYear(2020), JulianMonth(2), JulianDay(29)};
+    const JulianDate last {JulianYear(2024), JulianMonth(12), JulianDay(31)};
+    std::vector<JulianDate> dates;
+    for (const JulianDate date : JulianDateRange(first, last, Years(1)))
+     {
+      dates.push_back(date);
+     }
+    ASSERT_EQ(dates.size(), 5);
+    ASSERT_EQ(dates[1], JulianDate(JulianYear(2021), JulianMonth(2), JulianDay(28)));
+    ASSERT_EQ(dates[4], JulianDate(JulianYear(2024), JulianMonth(2), JulianDay(29)));
+   }
+
+
+  TEST(JulianDateRangeTest, years2)
+   {
+    const JulianDate first {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    const JulianDate last {JulianYear(32767), JulianMonth(12), JulianDay(31)};
+    const JulianDateRange range {first, last, Years(100)};
+    ASSERT_EQ(range.size(), 328);
+    JulianDate date = first;
+    for (auto iter = range.begin(); iter != range.end(); iter++)
+     {
+      date = *iter;
+     }
+    ASSERT_EQ(date, JulianDate(JulianYear(32708), JulianMonth(1), JulianDay(1)));
+   }
+
+ }
@@ -8,6 +8,9 @@
 #include <iostream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
 #include "JulianDate.h"
 
 
@@ -84,6 +87,64 @@ namespace
    }
 
 
+  TEST(JulianDateTest, constructor8)
+   {
+    constexpr JD jd {13689569};
+    constexpr JulianDate date {jd};
+    ASSERT_EQ(date.getDay().getDay(), 31);
+    ASSERT_EQ(date.getMonth().getMonth(), 12);
+    ASSERT_EQ(date.getYear().getYear(), 32767);
+   }
+
+
+  TEST(JulianDateTest, constructor9)
+   {
+    constexpr JD jd {1725500};
+    constexpr JulianDate date {jd};
+    ASSERT_EQ(date.getDay().getDay(), 29);
+    ASSERT_EQ(date.getMonth().getMonth(), 2);
+    ASSERT_EQ(date.getMonth().getDaysInMonth().getDays(), 29);
+    ASSERT_EQ(date.getYear().getYear(), 12);
+   }
+
+
+  TEST(JulianDateTest, constructor10)
+   {
+    try
+     {
+      [[maybe_unused]] const JulianDate date {JD(1723979)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year is < 8 or > 32767").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(JulianDateTest, constructor11)
+   {
+    constexpr JulianDate date {JulianYear(12), Days(60)};
+    ASSERT_EQ(date.getYear().getYear(), 12);
+    ASSERT_EQ(date.getMonth().getMonth(), 2);
+    ASSERT_EQ(date.getDay().getDay(), 29);
+   }
+
+
+  TEST(JulianDateTest, constructor12)
+   {
+    try
+     {
+      [[maybe_unused]] const JulianDate date {JulianYear(13), Days(366)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("day within year is < 1 or > 365").compare(e.what()), 0);
+     }
+   }
+
+
   TEST(JulianDateTest, constructor7)
    {
     try
@@ -99,6 +160,70 @@ namespace
    }
 
 
+  TEST(JulianDateTest, tryMake1)
+   {
+    constexpr Expected<JulianDate> date = JulianDate::tryMake(12, 2, 29);
+    ASSERT_TRUE(date.hasValue());
+    ASSERT_EQ(date.getValue(), JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29)));
+   }
+
+
+  TEST(JulianDateTest, tryMake2)
+   {
+    constexpr Expected<JulianDate> date = JulianDate::tryMake(7, 12, 31);
+    ASSERT_EQ(date.getError(), ValidationError::YearOutOfRange);
+   }
+
+
+  TEST(JulianDateTest, tryMake3)
+   {
+    constexpr Expected<JulianDate> date = JulianDate::tryMake(12, 13, 1);
+    ASSERT_EQ(date.getError(), ValidationError::MonthOutOfRange);
+   }
+
+
+  TEST(JulianDateTest, tryMake4)
+   {
+    constexpr Expected<JulianDate> date = JulianDate::tryMake(13, 2, 29);
+    ASSERT_EQ(date.getError(), ValidationError::DayOutOfRange);
+   }
+
+
+  TEST(JulianDateTest, tryMake5)
+   {
+    constexpr Expected<JulianDate> date = JulianDate::tryMake(JD(1725500));
+    ASSERT_TRUE(date.hasValue());
+    ASSERT_EQ(date.getValue(), JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29)));
+   }
+
+
+  TEST(JulianDateTest, tryMake6)
+   {
+    constexpr Expected<JulianDate> date = JulianDate::tryMake(JD(1723979));
+    ASSERT_EQ(date.getError(), ValidationError::JDOutOfRange);
+   }
+
+
+  TEST(JulianDateTest, uncheckedConstructor1)
+   {
+    constexpr JulianDate date {unchecked, 12, 2, 29};
+    ASSERT_EQ(date, JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29)));
+   }
+
+
+  TEST(JulianDateTest, uncheckedConstructor2)
+   {
+    constexpr JulianDate date {unchecked, JD(1725500)};
+    ASSERT_EQ(date, JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29)));
+   }
+
+
+  TEST(JulianDateTest, uncheckedConstructor3)
+   {
+    EXPECT_DEBUG_DEATH({[[maybe_unused]] const JulianDate date(unchecked, 13, 2, 29);}, "");
+   }
+
+
   TEST(JulianDateTest, copyConstructor)
    {
     constexpr JulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
@@ -120,6 +245,46 @@ namespace
    }
 
 
+  TEST(JulianDateTest, copyAssignment)
+   {
+    const JulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    JulianDate date2 {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    date2 = date1;
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(JulianDateTest, moveAssignment)
+   {
+    JulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    JulianDate date2 {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    date2 = std::move(date1);
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(JulianDateTest, triviallyCopyable)
+   {
+    ASSERT_TRUE(std::is_trivially_copyable_v<JulianDate>);
+    ASSERT_TRUE(std::is_copy_assignable_v<JulianDate>);
+    ASSERT_TRUE(std::is_move_assignable_v<JulianDate>);
+   }
+
+
+  TEST(JulianDateTest, sort)
+   {
+    std::vector<JulianDate> dates {JulianDate(JulianYear(13), JulianMonth(1), JulianDay(1)), JulianDate(JulianYear(12), JulianMonth(12), JulianDay(31)), JulianDate(JulianYear(12), JulianMonth(1), JulianDay(12))};
+    std::sort(dates.begin(), dates.end());
+    ASSERT_EQ(dates[0], JulianDate(JulianYear(12), JulianMonth(1), JulianDay(12)));
+    ASSERT_EQ(dates[1], JulianDate(JulianYear(12), JulianMonth(12), JulianDay(31)));
+    ASSERT_EQ(dates[2], JulianDate(JulianYear(13), JulianMonth(1), JulianDay(1)));
+   }
+
+
   TEST(JulianDateTest, getDay)
    {
     constexpr JulianDate date {JulianYear(8), JulianMonth(2), JulianDay(1)};
@@ -155,6 +320,13 @@ namespace
    }
 
 
+  TEST(JulianDateTest, getWeekday3)
+   {
+    constexpr JulianDate date {JulianYear(32767), JulianMonth(12), JulianDay(31)};
+    ASSERT_EQ(date.getWeekday(), Weekdays::Saturday);
+   }
+
+
   TEST(JulianDateTest, getDayWithinYear1)
    {
     constexpr JulianDate date {JulianYear(8), JulianMonth(1), JulianDay(1)};
@@ -204,6 +376,20 @@ namespace
    }
 
 
+  TEST(JulianDateTest, getWeek5)
+   {
+    constexpr JulianDate date {JulianYear(10000), JulianMonth(12), JulianDay(31)};
+    ASSERT_EQ(date.getWeek().getWeek(), 1);
+   }
+
+
+  TEST(JulianDateTest, getWeek6)
+   {
+    constexpr JulianDate date {JulianYear(32767), JulianMonth(1), JulianDay(1)};
+    ASSERT_EQ(date.getWeek().getWeek(), 52);
+   }
+
+
   TEST(JulianDateTest, getJD1)
    {
     constexpr JulianDate date {JulianYear(8), JulianMonth(1), JulianDay(1)};
@@ -390,6 +576,58 @@ namespace
    }
 
 
+  TEST(JulianDateTest, plusDays3)
+   {
+    constexpr JulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr Days days {100000};
+    constexpr JulianDate newDate = date1 + days;
+    ASSERT_EQ(newDate.getDay().getDay(), 25);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 9);
+    ASSERT_EQ(newDate.getYear().getYear(), 286);
+   }
+
+
+  TEST(JulianDateTest, plusDays4)
+   {
+    constexpr JulianDate date1 {JulianYear(32767), JulianMonth(12), JulianDay(31)};
+    try
+     {
+      [[maybe_unused]] const JulianDate newDate = date1 + Days(1);
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year will be > 32767").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(JulianDateTest, minusDays3)
+   {
+    constexpr JulianDate date1 {JulianYear(286), JulianMonth(9), JulianDay(25)};
+    constexpr Days days {100000};
+    constexpr JulianDate newDate = date1 - days;
+    ASSERT_EQ(newDate.getDay().getDay(), 12);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(JulianDateTest, minusDays4)
+   {
+    constexpr JulianDate date1 {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    try
+     {
+      [[maybe_unused]] const JulianDate newDate = date1 - Days(1);
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year will be < 8").compare(e.what()), 0);
+     }
+   }
+
+
   TEST(JulianDateTest, plusMonths1)
    {
     constexpr JulianDate date1 {JulianYear(12), JulianMonth(6), JulianDay(12)};
@@ -637,6 +875,15 @@ namespace
    }
 
 
+  TEST(JulianDateTest, dayDiff4)
+   {
+    constexpr JulianDate date1 {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    constexpr JulianDate date2 {JulianYear(32767), JulianMonth(12), JulianDay(31)};
+    constexpr Days newDays = dayDiff(date1, date2);
+    ASSERT_EQ(newDays.getDays(), 11965589);
+   }
+
+
   TEST(JulianDateTest, minusJulianDateJulianDate1)
    {
     constexpr JulianDate date1 {JulianYear(12), JulianMonth(1), JulianDay(1)};
@@ -703,6 +950,50 @@ namespace
    }
 
 
+  TEST(JulianDateTest, minusJulianDateJulianDate7)
+   {
+    constexpr JulianDate date1 {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    constexpr JulianDate date2 {JulianYear(32767), JulianMonth(12), JulianDay(31)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 32759);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 11);
+    ASSERT_EQ(newDuration.getDays().getDays(), 30);
+   }
+
+
+  TEST(JulianDateTest, minusJulianDateJulianDate8)
+   {
+    constexpr JulianDate date1 {JulianYear(13), JulianMonth(1), JulianDay(31)};
+    constexpr JulianDate date2 {JulianYear(13), JulianMonth(3), JulianDay(1)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 1);
+    ASSERT_EQ(newDuration.getDays().getDays(), 1);
+   }
+
+
+  TEST(JulianDateTest, minusJulianDateJulianDate9)
+   {
+    constexpr JulianDate date1 {JulianYear(12), JulianMonth(3), JulianDay(1)};
+    constexpr JulianDate date2 {JulianYear(12), JulianMonth(1), JulianDay(31)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 1);
+    ASSERT_EQ(newDuration.getDays().getDays(), 1);
+   }
+
+
+  TEST(JulianDateTest, minusJulianDateJulianDate10)
+   {
+    constexpr JulianDate date1 {JulianYear(13), JulianMonth(2), JulianDay(28)};
+    constexpr JulianDate date2 {JulianYear(12), JulianMonth(2), JulianDay(29)};
+    constexpr Duration newDuration = date1 - date2;
+    ASSERT_EQ(newDuration.getYears().getYears(), 0);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 11);
+    ASSERT_EQ(newDuration.getDays().getDays(), 30);
+   }
+
+
   TEST(JulianDateTest, getEaster1)
    {
     constexpr JulianYear year {1582};
@@ -712,6 +1003,20 @@ namespace
    }
 
 
+  TEST(JulianDateTest, getEaster2)
+   {
+    const JulianYear years[] = {JulianYear(1582), JulianYear(2024), JulianYear(2025), JulianYear(8), JulianYear(32767)};
+    JulianDate easters[5] = {JulianDate(JD(minJulianJD)), JulianDate(JD(minJulianJD)), JulianDate(JD(minJulianJD)), JulianDate(JD(minJulianJD)), JulianDate(JD(minJulianJD))};
+    getEaster(years, 5, easters);
+    for (std::size_t i = 0; i < 5; ++i)
+     {
+      ASSERT_EQ(easters[i], getEaster(years[i]));
+     }
+    ASSERT_EQ(easters[1], JulianDate(JulianYear(2024), JulianMonth(4), JulianDay(22)));
+    ASSERT_EQ(easters[2], JulianDate(JulianYear(2025), JulianMonth(4), JulianDay(7)));
+   }
+
+
   TEST(JulianDateTest, coutDay1)
    {
     constexpr JulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
@@ -748,4 +1053,27 @@ namespace
     ASSERT_EQ(date.getDay().getDay(), 9);
    }
 
+
+  TEST(JulianDateTest, factory4)
+   {
+    constexpr JulianDate date = factory(JulianYear(10000), JulianWeek(1), Weekdays::Monday);
+    ASSERT_EQ(date.getYear().getYear(), 9999);
+    ASSERT_EQ(date.getMonth().getMonth(), 12);
+    ASSERT_EQ(date.getDay().getDay(), 31);
+   }
+
+
+  TEST(JulianDateTest, factory5)
+   {
+    try
+     {
+      [[maybe_unused]] const JulianDate date = factory(JulianYear(32767), JulianWeek(52), Weekdays::Sunday);
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string("year will be > 32767").compare(e.what()), 0);
+     }
+   }
+
  }
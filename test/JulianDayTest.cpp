@@ -131,6 +131,43 @@ namespace
    }
 
 
+  TEST(JulianDayTest, tryMake1)
+   {
+    constexpr Expected<JulianDay> day = JulianDay::tryMake(31);
+    ASSERT_TRUE(day.hasValue());
+    ASSERT_EQ(day.getValue().getDay(), 31);
+   }
+
+
+  TEST(JulianDayTest, tryMake2)
+   {
+    constexpr Expected<JulianDay> day = JulianDay::tryMake(32);
+    ASSERT_EQ(day.getError(), ValidationError::DayOutOfRange);
+   }
+
+
+  TEST(JulianDayTest, tryMake3)
+   {
+    constexpr Expected<JulianDay> day = JulianDay::tryMake(JulianMonth(JulianYear(12), 2), 29);
+    ASSERT_TRUE(day.hasValue());
+    ASSERT_EQ(day.getValue().getDay(), 29);
+   }
+
+
+  TEST(JulianDayTest, tryMake4)
+   {
+    constexpr Expected<JulianDay> day = JulianDay::tryMake(JulianMonth(JulianYear(13), 2), 29);
+    ASSERT_EQ(day.getError(), ValidationError::DayOutOfRange);
+   }
+
+
+  TEST(JulianDayTest, uncheckedConstructor1)
+   {
+    constexpr JulianDay day {unchecked, 31};
+    ASSERT_EQ(day.getDay(), 31);
+   }
+
+
   TEST(JulianDayTest, copyConstructor)
    {
     constexpr JulianDay day1 {12};
@@ -148,6 +185,24 @@ namespace
    }
 
 
+  TEST(JulianDayTest, copyAssignment)
+   {
+    const JulianDay day1 {12};
+    JulianDay day2 {1};
+    day2 = day1;
+    ASSERT_EQ(day2.getDay(), 12);
+   }
+
+
+  TEST(JulianDayTest, moveAssignment)
+   {
+    JulianDay day1 {12};
+    JulianDay day2 {1};
+    day2 = std::move(day1);
+    ASSERT_EQ(day2.getDay(), 12);
+   }
+
+
   TEST(JulianDayTest, equalOperator1)
    {
     constexpr JulianDay day1 {12};
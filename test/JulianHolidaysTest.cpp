@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <array>
+#include <thread>
+#include <vector>
+#include "JulianHolidays.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Some holiday rules.
+   */
+  const std::array<HolidayRule, 5> rules {HolidayRule::fixed(JulianMonth(1), JulianDay(1)), HolidayRule::fixed(JulianMonth(12), JulianDay(25)), HolidayRule::nthWeekday(JulianMonth(5), Weekdays::Monday, -1), HolidayRule::easter(-2), HolidayRule::easter(1)};
+
+
+  /**
+   * Julian date from primitive data types.
+   *
+   * @param[in] year Year
+   * @param[in] month Month
+   * @param[in] day Day
+   * @return JulianDate
+   */
+  auto date(const long year, const unsigned short month, const unsigned short day) -> JulianDate
+   {
+    return(JulianDate(JulianYear(year), JulianMonth(month), JulianDay(day)));
+   }
+
+
+  TEST(JulianHolidaysTest, isHoliday1)
+   {
+    const JulianHolidays holidays {rules.data(), rules.size()};
+    ASSERT_TRUE(holidays.isHoliday(date(2024, 1, 1)));
+    ASSERT_FALSE(holidays.isHoliday(date(2024, 1, 2)));
+    ASSERT_TRUE(holidays.isHoliday(date(2024, 4, 20)));
+    ASSERT_TRUE(holidays.isHoliday(date(2024, 4, 23)));
+    ASSERT_FALSE(holidays.isHoliday(date(2024, 4, 22)));
+    ASSERT_TRUE(holidays.isHoliday(date(2024, 12, 25)));
+    ASSERT_TRUE(holidays.isHoliday(date(2024, 12, 25).getJD()));
+    ASSERT_FALSE(holidays.isHoliday(date(2024, 12, 26).getJD()));
+   }
+
+
+  TEST(JulianHolidaysTest, isHoliday2)
+   {
+    const JulianHolidays holidays {rules.data(), rules.size()};
+    ASSERT_TRUE(holidays.isHoliday(date(8, 1, 1)));
+    ASSERT_TRUE(holidays.isHoliday(date(32767, 12, 25)));
+    ASSERT_FALSE(holidays.isHoliday(date(32767, 12, 31)));
+   }
+
+
+  TEST(JulianHolidaysTest, getHolidays1)
+   {
+    const JulianHolidays holidays {rules.data(), rules.size()};
+    const HolidaySet &set = holidays.getHolidays(JulianYear(2024));
+    ASSERT_EQ(&set, &holidays.getHolidays(JulianYear(2024)));
+    unsigned long count = 0;
+    for (std::uint64_t word : set)
+     {
+      for (; word != 0; word &= word - 1U)
+       {
+        ++count;
+       }
+     }
+    ASSERT_EQ(count, 5);
+   }
+
+
+  TEST(JulianHolidaysTest, appendHolidays1)
+   {
+    const JulianHolidays holidays {rules.data(), rules.size()};
+    std::vector<JD> jds;
+    holidays.appendHolidays(JulianYear(2024), jds);
+    ASSERT_EQ(jds, (std::vector<JD>{date(2024, 1, 1).getJD(), date(2024, 4, 20).getJD(), date(2024, 4, 23).getJD(), date(2024, 5, 28).getJD(), date(2024, 12, 25).getJD()}));
+   }
+
+
+  TEST(JulianHolidaysTest, threads1)
+   {
+    const JulianHolidays holidays {rules.data(), rules.size()};
+    std::array<unsigned long, 4> counts {};
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < counts.size(); ++t)
+     {
+      threads.emplace_back([&holidays, &counts, t]()
+       {
+        for (long year = 8; year <= 32767; ++year)
+         {
+          counts[t] += holidays.isHoliday(JulianDate(JulianYear(year), JulianMonth(12), JulianDay(25))) ? 1 : 0;
+         }
+       });
+     }
+    for (std::thread &thread : threads)
+     {
+      thread.join();
+     }
+    for (const unsigned long count : counts)
+     {
+      ASSERT_EQ(count, 32760);
+     }
+   }
+
+ }
@@ -83,6 +83,51 @@ namespace
    }
 
 
+  TEST(JulianMonthTest, tryMake1)
+   {
+    constexpr Expected<JulianMonth> month = JulianMonth::tryMake(12);
+    ASSERT_TRUE(month.hasValue());
+    ASSERT_EQ(month.getValue().getMonth(), 12);
+   }
+
+
+  TEST(JulianMonthTest, tryMake2)
+   {
+    constexpr Expected<JulianMonth> month = JulianMonth::tryMake(0);
+    ASSERT_FALSE(month.hasValue());
+    ASSERT_EQ(month.getError(), ValidationError::MonthOutOfRange);
+   }
+
+
+  TEST(JulianMonthTest, tryMake3)
+   {
+    constexpr Expected<JulianMonth> month = JulianMonth::tryMake(JulianYear(12), 2);
+    ASSERT_TRUE(month.hasValue());
+    ASSERT_EQ(month.getValue().getDaysInMonth().getDays(), 29);
+   }
+
+
+  TEST(JulianMonthTest, tryMake4)
+   {
+    constexpr Expected<JulianMonth> month = JulianMonth::tryMake(JulianYear(12), 13);
+    ASSERT_EQ(month.getError(), ValidationError::MonthOutOfRange);
+   }
+
+
+  TEST(JulianMonthTest, uncheckedConstructor1)
+   {
+    constexpr JulianMonth month {unchecked, 12};
+    ASSERT_EQ(month.getMonth(), 12);
+   }
+
+
+  TEST(JulianMonthTest, uncheckedConstructor2)
+   {
+    constexpr JulianMonth month {unchecked, JulianYear(12), 2};
+    ASSERT_EQ(month.getDaysInMonth().getDays(), 29);
+   }
+
+
   TEST(JulianMonthTest, copyConstructor)
    {
     constexpr JulianMonth month1 {6};
@@ -100,6 +145,24 @@ namespace
    }
 
 
+  TEST(JulianMonthTest, copyAssignment)
+   {
+    const JulianMonth month1 {12};
+    JulianMonth month2 {1};
+    month2 = month1;
+    ASSERT_EQ(month2.getMonth(), 12);
+   }
+
+
+  TEST(JulianMonthTest, moveAssignment)
+   {
+    JulianMonth month1 {12};
+    JulianMonth month2 {1};
+    month2 = std::move(month1);
+    ASSERT_EQ(month2.getMonth(), 12);
+   }
+
+
   TEST(JulianMonthTest, getMonth)
    {
     constexpr JulianMonth month1 {12};
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "JulianRecurrence.h"
+#include "JulianDateRange.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  /**
+   * Expand a recurrence into a vector.
+   *
+   * @param[in] start Start date
+   * @param[in] rule Recurrence rule
+   * @return Occurrences
+   */
+  auto expand(const JulianDate &start, const RecurrenceRule &rule) -> std::vector<JulianDate>
+   {
+    std::vector<JulianDate> result;
+    for (const JulianDate date : JulianRecurrence(start, rule))
+     {
+      result.push_back(date);
+     }
+    return(result);
+   }
+
+
+  /**
+   * Julian date from primitive data types.
+   *
+   * @param[in] year Year
+   * @param[in] month Month
+   * @param[in] day Day
+   * @return JulianDate
+   */
+  auto date(const long year, const unsigned short month, const unsigned short day) -> JulianDate
+   {
+    return(JulianDate(JulianYear(year), JulianMonth(month), JulianDay(day)));
+   }
+
+
+  TEST(JulianRecurrenceTest, daily1)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 2, 27), RecurrenceRule(Frequency::Daily).withCount(4));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 2, 27), date(2024, 2, 28), date(2024, 2, 29), date(2024, 3, 1)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, daily2)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), RecurrenceRule(Frequency::Daily, 10).withUntil(date(2024, 1, 31).getJD()));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 1, 1), date(2024, 1, 11), date(2024, 1, 21), date(2024, 1, 31)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, daily3)
+   {
+    const RecurrenceRule rule = RecurrenceRule(Frequency::Daily).withByDay(Weekdays::Saturday).withByDay(Weekdays::Sunday).withByMonthDay(-1).withUntil(date(2024, 12, 31).getJD());
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), rule);
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 3, 31), date(2024, 6, 30), date(2024, 9, 30)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, weekly1)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), RecurrenceRule(Frequency::Weekly, 2).withByDay(Weekdays::Tuesday).withCount(5));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 1, 10), date(2024, 1, 24), date(2024, 2, 7), date(2024, 2, 21), date(2024, 3, 6)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, weekly2)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), RecurrenceRule(Frequency::Weekly).withCount(3));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 1, 1), date(2024, 1, 8), date(2024, 1, 15)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, monthly1)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), RecurrenceRule(Frequency::Monthly).withByDay(Weekdays::Tuesday, 2).withCount(3));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 1, 10), date(2024, 2, 14), date(2024, 3, 13)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, monthly2)
+   {
+    RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withBySetPos(-1).withCount(12);
+    for (const Weekdays weekday : {Weekdays::Monday, Weekdays::Tuesday, Weekdays::Wednesday, Weekdays::Thursday, Weekdays::Friday})
+     {
+      rule = rule.withByDay(weekday);
+     }
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), rule);
+    const std::vector<unsigned short> days {31, 29, 30, 30, 31, 29, 31, 31, 28, 31, 30, 31};
+    ASSERT_EQ(dates.size(), days.size());
+    for (std::size_t i = 0; i < days.size(); ++i)
+     {
+      ASSERT_EQ(dates[i], date(2024, static_cast<unsigned short>(i + 1), days[i]));
+     }
+   }
+
+
+  TEST(JulianRecurrenceTest, monthly3)
+   {
+    const RecurrenceRule rule = RecurrenceRule(Frequency::Monthly, 3).withByMonthDay(31).withCount(5);
+    ASSERT_EQ(expand(date(2024, 1, 31), rule.withSkip(SkipRule::Backward)), (std::vector<JulianDate>{date(2024, 1, 31), date(2024, 4, 30), date(2024, 7, 31), date(2024, 10, 31), date(2025, 1, 31)}));
+    ASSERT_EQ(expand(date(2024, 1, 31), rule), (std::vector<JulianDate>{date(2024, 1, 31), date(2024, 7, 31), date(2024, 10, 31), date(2025, 1, 31), date(2025, 7, 31)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, monthly4)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 31), RecurrenceRule(Frequency::Monthly).withSkip(SkipRule::Backward).withCount(3));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 1, 31), date(2024, 2, 29), date(2024, 3, 31)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, monthly5)
+   {
+    // First monday and last friday of each month against a day by day check
+    const RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withByDay(Weekdays::Monday, 1).withByDay(Weekdays::Friday, -1).withUntil(date(2100, 12, 31).getJD());
+    const std::vector<JulianDate> dates = expand(date(2000, 1, 1), rule);
+    std::vector<JulianDate> expected;
+    for (const JulianDate day : JulianDateRange(date(2000, 1, 1), date(2100, 12, 31)))
+     {
+      const Weekdays weekday = day.getWeekday();
+      const unsigned short dayOfMonth = day.getDay().getDay();
+      if (((weekday == Weekdays::Monday) && (dayOfMonth <= 7)) || ((weekday == Weekdays::Friday) && (dayOfMonth + 7U > day.getMonth().getDaysInMonth().getDays())))
+       {
+        expected.push_back(day);
+       }
+     }
+    ASSERT_EQ(dates, expected);
+   }
+
+
+  TEST(JulianRecurrenceTest, yearly1)
+   {
+    const RecurrenceRule rule = RecurrenceRule(Frequency::Yearly).withCount(3);
+    ASSERT_EQ(expand(date(2024, 2, 29), rule), (std::vector<JulianDate>{date(2024, 2, 29), date(2028, 2, 29), date(2032, 2, 29)}));
+    ASSERT_EQ(expand(date(2024, 2, 29), rule.withSkip(SkipRule::Backward)), (std::vector<JulianDate>{date(2024, 2, 29), date(2025, 2, 28), date(2026, 2, 28)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, yearly2)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), RecurrenceRule(Frequency::Yearly).withByDay(Weekdays::Sunday, -1).withCount(3));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 12, 30), date(2025, 12, 29), date(2026, 12, 28)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, yearly3)
+   {
+    const std::vector<JulianDate> dates = expand(date(2024, 3, 1), RecurrenceRule(Frequency::Yearly).withByMonthDay(1).withCount(3));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(2024, 3, 1), date(2024, 4, 1), date(2024, 5, 1)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, yearly4)
+   {
+    const std::vector<JulianDate> dates = expand(date(32766, 1, 1), RecurrenceRule(Frequency::Yearly));
+    ASSERT_EQ(dates, (std::vector<JulianDate>{date(32766, 1, 1), date(32767, 1, 1)}));
+   }
+
+
+  TEST(JulianRecurrenceTest, setPos1)
+   {
+    const RecurrenceRule rule = RecurrenceRule(Frequency::Yearly).withByDay(Weekdays::Monday).withBySetPos(1).withBySetPos(-1).withBySetPos(60).withCount(3);
+    const std::vector<JulianDate> dates = expand(date(2024, 1, 1), rule);
+    ASSERT_EQ(dates.size(), 3);
+    ASSERT_EQ(dates[0].getWeekday(), Weekdays::Monday);
+    ASSERT_EQ(dates[0].getMonth().getMonth(), 1);
+    ASSERT_LE(dates[0].getDay().getDay(), 7);
+    ASSERT_EQ(dates[1].getYear().getYear(), 2024);
+    ASSERT_EQ(dates[1].getMonth().getMonth(), 12);
+    ASSERT_GT(dates[1].getDay().getDay(), 24);
+    ASSERT_EQ(dates[2].getYear().getYear(), 2025);
+   }
+
+
+  TEST(JulianRecurrenceTest, setPos2)
+   {
+    const RecurrenceRule rule = RecurrenceRule(Frequency::Yearly).withByDay(Weekdays::Tuesday).withByDay(Weekdays::Thursday).withBySetPos(2).withBySetPos(70).withBySetPos(-2).withBySetPos(-70).withUntil(date(2031, 12, 31).getJD());
+    std::vector<JulianDate> expected;
+    for (long year = 2024; year <= 2031; ++year)
+     {
+      std::vector<JulianDate> days;
+      for (JulianDate day = date(year, 1, 1); day.getYear().getYear() == year; day = day + Days(1))
+       {
+        if ((day.getWeekday() == Weekdays::Tuesday) || (day.getWeekday() == Weekdays::Thursday))
+         {
+          days.push_back(day);
+         }
+       }
+      expected.insert(expected.end(), {days[1], days[days.size() - 70], days[69], days[days.size() - 2]});
+     }
+    ASSERT_EQ(expand(date(2024, 1, 1), rule), expected);
+   }
+
+
+  TEST(JulianRecurrenceTest, empty1)
+   {
+    const JulianRecurrence recurrence {date(2024, 1, 2), RecurrenceRule(Frequency::Daily).withUntil(date(2024, 1, 1).getJD())};
+    ASSERT_EQ(recurrence.begin(), recurrence.end());
+   }
+
+
+  TEST(JulianRecurrenceTest, iterator1)
+   {
+    const JulianRecurrence recurrence {date(2024, 1, 1), RecurrenceRule(Frequency::Daily).withCount(2)};
+    auto iter = recurrence.begin();
+    ASSERT_EQ(iter.getJD(), date(2024, 1, 1).getJD());
+    auto before = iter++;
+    ASSERT_EQ(*before, date(2024, 1, 1));
+    ASSERT_EQ(*iter, date(2024, 1, 2));
+    ++iter;
+    ASSERT_EQ(iter, recurrence.end());
+   }
+
+ }
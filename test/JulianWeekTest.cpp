@@ -80,6 +80,50 @@ namespace
   }
 
 
+  TEST(JulianWeekTest, tryMake1)
+   {
+    constexpr Expected<JulianWeek> week = JulianWeek::tryMake(53);
+    ASSERT_TRUE(week.hasValue());
+    ASSERT_EQ(week.getValue().getWeek(), 53);
+   }
+
+
+  TEST(JulianWeekTest, tryMake2)
+   {
+    constexpr Expected<JulianWeek> week = JulianWeek::tryMake(54);
+    ASSERT_EQ(week.getError(), ValidationError::WeekOutOfRange);
+   }
+
+
+  TEST(JulianWeekTest, tryMake3)
+   {
+    constexpr Expected<JulianWeek> week = JulianWeek::tryMake(53, JulianYear(11));
+    ASSERT_TRUE(week.hasValue());
+    ASSERT_EQ(week.getValue().getMaxWeeks(), 53);
+   }
+
+
+  TEST(JulianWeekTest, tryMake4)
+   {
+    constexpr Expected<JulianWeek> week = JulianWeek::tryMake(53, JulianYear(8));
+    ASSERT_EQ(week.getError(), ValidationError::WeekOutOfRange);
+   }
+
+
+  TEST(JulianWeekTest, uncheckedConstructor1)
+   {
+    constexpr JulianWeek week {unchecked, 53};
+    ASSERT_EQ(week.getWeek(), 53);
+   }
+
+
+  TEST(JulianWeekTest, uncheckedConstructor2)
+   {
+    constexpr JulianWeek week {unchecked, 52, JulianYear(8)};
+    ASSERT_EQ(week.getMaxWeeks(), 52);
+   }
+
+
  TEST(JulianWeekTest, copyConstructor)
   {
    constexpr JulianWeek week1 {12};
@@ -97,6 +141,24 @@ namespace
    }
 
 
+  TEST(JulianWeekTest, copyAssignment)
+   {
+    const JulianWeek week1 {12};
+    JulianWeek week2 {1};
+    week2 = week1;
+    ASSERT_EQ(week2.getWeek(), 12);
+   }
+
+
+  TEST(JulianWeekTest, moveAssignment)
+   {
+    JulianWeek week1 {12};
+    JulianWeek week2 {1};
+    week2 = std::move(week1);
+    ASSERT_EQ(week2.getWeek(), 12);
+   }
+
+
  TEST(JulianWeekTest, getMaxWeeks1)
   {
    constexpr JulianWeek week {53, JulianYear(11)};
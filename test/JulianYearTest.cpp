@@ -92,6 +92,29 @@ namespace
    }
 
 
+  TEST(JulianYearTest, tryMake1)
+   {
+    constexpr Expected<JulianYear> year = JulianYear::tryMake(8);
+    ASSERT_TRUE(year.hasValue());
+    ASSERT_EQ(year.getValue().getYear(), 8);
+   }
+
+
+  TEST(JulianYearTest, tryMake2)
+   {
+    constexpr Expected<JulianYear> year = JulianYear::tryMake(32768);
+    ASSERT_FALSE(year.hasValue());
+    ASSERT_EQ(year.getError(), ValidationError::YearOutOfRange);
+   }
+
+
+  TEST(JulianYearTest, uncheckedConstructor1)
+   {
+    constexpr JulianYear year {unchecked, 32767};
+    ASSERT_EQ(year.getYear(), 32767);
+   }
+
+
   TEST(JulianYearTest, copyConstructor)
    {
     constexpr JulianYear year1 {12};
@@ -109,6 +132,24 @@ namespace
    }
 
 
+  TEST(JulianYearTest, copyAssignment)
+   {
+    const JulianYear year1 {12};
+    JulianYear year2 {8};
+    year2 = year1;
+    ASSERT_EQ(year2.getYear(), 12);
+   }
+
+
+  TEST(JulianYearTest, moveAssignment)
+   {
+    JulianYear year1 {12};
+    JulianYear year2 {8};
+    year2 = std::move(year1);
+    ASSERT_EQ(year2.getYear(), 12);
+   }
+
+
   TEST(JulianYearTest, isLeapYear1)
    {
     constexpr JulianYear year {8};
@@ -151,6 +192,13 @@ namespace
    }
 
 
+  TEST(JulianYearTest, getWeeksInYear3)
+   {
+    constexpr JulianYear year {4401};
+    ASSERT_EQ(year.getWeeksInYear().getWeeks(), 53);
+   }
+
+
   TEST(JulianYearTest, getScaligerYear1)
    {
     constexpr JulianYear year {8};
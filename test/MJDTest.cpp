@@ -73,6 +73,24 @@ namespace
    }
 
 
+  TEST(MJDTest, copyAssignment)
+   {
+    const MJD mjd1 {12};
+    MJD mjd2 {1};
+    mjd2 = mjd1;
+    ASSERT_EQ(mjd2.getMJD(), 12);
+   }
+
+
+  TEST(MJDTest, moveAssignment)
+   {
+    MJD mjd1 {12};
+    MJD mjd2 {1};
+    mjd2 = std::move(mjd1);
+    ASSERT_EQ(mjd2.getMJD(), 12);
+   }
+
+
   TEST(MJDTest, getMJD)
    {
     constexpr MJD mjd {12};
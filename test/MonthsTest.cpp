@@ -48,6 +48,24 @@ namespace
    }
 
 
+  TEST(MonthsTest, copyAssignment)
+   {
+    const Months months1 {12};
+    Months months2 {1};
+    months2 = months1;
+    ASSERT_EQ(months2.getMonths(), 12);
+   }
+
+
+  TEST(MonthsTest, moveAssignment)
+   {
+    Months months1 {12};
+    Months months2 {1};
+    months2 = std::move(months1);
+    ASSERT_EQ(months2.getMonths(), 12);
+   }
+
+
   TEST(MonthsTest, equalOperator1)
    {
     constexpr Months months1 {12};
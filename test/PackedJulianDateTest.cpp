@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "PackedJulianDate.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(PackedJulianDateTest, size)
+   {
+    ASSERT_EQ(sizeof(PackedJulianDate), 4);
+   }
+
+
+  TEST(PackedJulianDateTest, constructor1)
+   {
+    constexpr PackedJulianDate date {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    ASSERT_EQ(date.getDay().getDay(), 1);
+    ASSERT_EQ(date.getMonth().getMonth(), 1);
+    ASSERT_EQ(date.getYear().getYear(), 8);
+   }
+
+
+  TEST(PackedJulianDateTest, constructor2)
+   {
+    constexpr PackedJulianDate date {JulianYear(32767), JulianMonth(12), JulianDay(31)};
+    ASSERT_EQ(date.getDay().getDay(), 31);
+    ASSERT_EQ(date.getMonth().getMonth(), 12);
+    ASSERT_EQ(date.getYear().getYear(), 32767);
+   }
+
+
+  TEST(PackedJulianDateTest, constructor3)
+   {
+    try
+     {
+      [[maybe_unused]] const PackedJulianDate date {JulianYear(8), JulianMonth(2), JulianDay(30)};
+      FAIL();
+     }
+    catch (const std::out_of_range& e)
+     {
+      // std::cout << e.what() << "\n";
+      ASSERT_EQ(std::string("day is > 29").compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(PackedJulianDateTest, constructor4)
+   {
+    constexpr JD jd {2299160};
+    constexpr PackedJulianDate date {jd};
+    ASSERT_EQ(date.getDay().getDay(), 4);
+    ASSERT_EQ(date.getMonth().getMonth(), 10);
+    ASSERT_EQ(date.getYear().getYear(), 1582);
+   }
+
+
+  TEST(PackedJulianDateTest, constructor5)
+   {
+    constexpr JulianDate date1 {JulianYear(12), JulianMonth(2), JulianDay(29)};
+    constexpr PackedJulianDate date2 {date1};
+    ASSERT_EQ(date2.getJulianDate(), date1);
+    ASSERT_EQ(date2.getMonth().getDaysInMonth().getDays(), 29);
+   }
+
+
+  TEST(PackedJulianDateTest, uncheckedConstructor1)
+   {
+    constexpr PackedJulianDate date {unchecked, (12U << 9U) | (2U << 5U) | 29U};
+    ASSERT_EQ(date.getJulianDate(), JulianDate(JulianYear(12), JulianMonth(2), JulianDay(29)));
+   }
+
+
+  TEST(PackedJulianDateTest, copyConstructor)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr PackedJulianDate date2 {date1};
+    ASSERT_EQ(date2.getPacked(), date1.getPacked());
+    ASSERT_TRUE(&date1 != &date2);
+   }
+
+
+  TEST(PackedJulianDateTest, moveConstructor)
+   {
+    PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    const PackedJulianDate date2 {std::move(date1)};
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(PackedJulianDateTest, copyAssignment)
+   {
+    const PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    PackedJulianDate date2 {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    date2 = date1;
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(PackedJulianDateTest, moveAssignment)
+   {
+    PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    PackedJulianDate date2 {JulianYear(8), JulianMonth(1), JulianDay(1)};
+    date2 = std::move(date1);
+    ASSERT_EQ(date2.getDay().getDay(), 12);
+    ASSERT_EQ(date2.getMonth().getMonth(), 12);
+    ASSERT_EQ(date2.getYear().getYear(), 12);
+   }
+
+
+  TEST(PackedJulianDateTest, getPacked)
+   {
+    constexpr PackedJulianDate date {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    ASSERT_EQ(date.getPacked(), (12U << 9U) | (12U << 5U) | 12U);
+   }
+
+
+  TEST(PackedJulianDateTest, getWeekday)
+   {
+    constexpr PackedJulianDate date {JulianYear(12), JulianMonth(12), JulianDay(1)};
+    ASSERT_EQ(date.getWeekday(), Weekdays::Thursday);
+   }
+
+
+  TEST(PackedJulianDateTest, getDayWithinYear)
+   {
+    constexpr PackedJulianDate date {JulianYear(12), JulianMonth(12), JulianDay(31)};
+    ASSERT_EQ(date.getDayWithinYear().getDays(), 366);
+   }
+
+
+  TEST(PackedJulianDateTest, getWeek)
+   {
+    constexpr PackedJulianDate date {JulianYear(8), JulianMonth(1), JulianDay(2)};
+    ASSERT_EQ(date.getWeek().getWeek(), 1);
+   }
+
+
+  TEST(PackedJulianDateTest, getJD)
+   {
+    constexpr PackedJulianDate date {JulianYear(1582), JulianMonth(10), JulianDay(4)};
+    ASSERT_EQ(date.getJD().getJD(), 2299160);
+   }
+
+
+  TEST(PackedJulianDateTest, equalOperator)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr PackedJulianDate date2 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    ASSERT_TRUE(date1 == date2);
+    ASSERT_FALSE(date1 != date2);
+   }
+
+
+  TEST(PackedJulianDateTest, smallerOperator1)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(31)};
+    constexpr PackedJulianDate date2 {JulianYear(13), JulianMonth(1), JulianDay(1)};
+    ASSERT_TRUE(date1 < date2);
+    ASSERT_TRUE(date1 <= date2);
+    ASSERT_FALSE(date1 > date2);
+    ASSERT_FALSE(date1 >= date2);
+   }
+
+
+  TEST(PackedJulianDateTest, smallerOperator2)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(1), JulianDay(31)};
+    constexpr PackedJulianDate date2 {JulianYear(12), JulianMonth(2), JulianDay(1)};
+    ASSERT_TRUE(date1 < date2);
+    ASSERT_TRUE(date2 > date1);
+   }
+
+
+  TEST(PackedJulianDateTest, plusDays)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 + Days(20);
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 1);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(PackedJulianDateTest, minusDays)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 - Days(18);
+    ASSERT_EQ(newDate.getDay().getDay(), 24);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 11);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(PackedJulianDateTest, plusMonths)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(6), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 + Months(7);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 1);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(PackedJulianDateTest, minusMonths)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(6), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 - Months(6);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 12);
+    ASSERT_EQ(newDate.getYear().getYear(), 11);
+   }
+
+
+  TEST(PackedJulianDateTest, plusYears)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(6), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 + Years(1);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(PackedJulianDateTest, minusYears)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(6), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 - Years(1);
+    ASSERT_EQ(newDate.getYear().getYear(), 11);
+   }
+
+
+  TEST(PackedJulianDateTest, plusWeeks)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 + Weeks(1);
+    ASSERT_EQ(newDate.getDay().getDay(), 19);
+   }
+
+
+  TEST(PackedJulianDateTest, minusWeeks)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr PackedJulianDate newDate = date1 - Weeks(1);
+    ASSERT_EQ(newDate.getDay().getDay(), 5);
+   }
+
+
+  TEST(PackedJulianDateTest, plusDuration)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(1), JulianDay(1)};
+    constexpr PackedJulianDate newDate = date1 + Duration(Years(1), Months(1), Days(1));
+    ASSERT_EQ(newDate.getDay().getDay(), 2);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 2);
+    ASSERT_EQ(newDate.getYear().getYear(), 13);
+   }
+
+
+  TEST(PackedJulianDateTest, minusDuration)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(13), JulianMonth(2), JulianDay(2)};
+    constexpr PackedJulianDate newDate = date1 - Duration(Years(1), Months(1), Days(1));
+    ASSERT_EQ(newDate.getDay().getDay(), 1);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 1);
+    ASSERT_EQ(newDate.getYear().getYear(), 12);
+   }
+
+
+  TEST(PackedJulianDateTest, plusWeekdays)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(1)}; // Thursday
+    constexpr PackedJulianDate newDate = date1 + Weekdays::Monday;
+    ASSERT_EQ(newDate.getDay().getDay(), 5);
+   }
+
+
+  TEST(PackedJulianDateTest, minusWeekdays)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(1)}; // Thursday
+    constexpr PackedJulianDate newDate = date1 - Weekdays::Monday;
+    ASSERT_EQ(newDate.getDay().getDay(), 28);
+    ASSERT_EQ(newDate.getMonth().getMonth(), 11);
+   }
+
+
+  TEST(PackedJulianDateTest, dayDiff)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    constexpr PackedJulianDate date2 {JulianYear(13), JulianMonth(1), JulianDay(1)};
+    ASSERT_EQ(dayDiff(date1, date2).getDays(), 20);
+   }
+
+
+  TEST(PackedJulianDateTest, minusPackedJulianDate)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(1), JulianDay(1)};
+    constexpr PackedJulianDate date2 {JulianYear(13), JulianMonth(2), JulianDay(2)};
+    constexpr Duration newDuration = date2 - date1;
+    ASSERT_EQ(newDuration.getYears().getYears(), 1);
+    ASSERT_EQ(newDuration.getMonths().getMonths(), 1);
+    ASSERT_EQ(newDuration.getDays().getDays(), 1);
+   }
+
+
+  TEST(PackedJulianDateTest, coutDate)
+   {
+    constexpr PackedJulianDate date1 {JulianYear(12), JulianMonth(12), JulianDay(12)};
+    testing::internal::CaptureStdout();
+    std::cout << date1;
+    const std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output, "PackedJulianDate(JulianYear(12), JulianMonth(12), JulianDay(12))");
+   }
+
+ }
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <climits>
+#include <stdexcept>
+#include "RecurrenceRule.h"
+
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(RecurrenceRuleTest, constructor1)
+   {
+    constexpr RecurrenceRule rule {Frequency::Monthly, 3};
+    ASSERT_EQ(rule.getFrequency(), Frequency::Monthly);
+    ASSERT_EQ(rule.getInterval(), 3);
+    ASSERT_EQ(rule.getWeekdays(), 0);
+    ASSERT_EQ(rule.getOrdinalCount(), 0);
+    ASSERT_EQ(rule.getMonthDays(), 0U);
+    ASSERT_EQ(rule.getLastMonthDays(), 0U);
+    ASSERT_EQ(rule.getSetPositionCount(), 0);
+    ASSERT_EQ(rule.getCount(), 0);
+    ASSERT_EQ(rule.getUntil(), ULONG_MAX);
+    ASSERT_EQ(rule.getSkip(), SkipRule::Omit);
+   }
+
+
+  TEST(RecurrenceRuleTest, constructor2)
+   {
+    try
+     {
+      const RecurrenceRule rule {Frequency::Daily, 0};
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"interval is 0"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(RecurrenceRuleTest, withByDay1)
+   {
+    constexpr RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withByDay(Weekdays::Monday).withByDay(Weekdays::Friday, -1);
+    ASSERT_EQ(rule.getWeekdays(), 1U << 1U);
+    ASSERT_EQ(rule.getAllWeekdays(), (1U << 1U) | (1U << 5U));
+    ASSERT_EQ(rule.getOrdinalCount(), 1);
+    ASSERT_EQ(rule.getOrdinalWeekday(0), Weekdays::Friday);
+    ASSERT_EQ(rule.getOrdinal(0), -1);
+   }
+
+
+  TEST(RecurrenceRuleTest, withByDay2)
+   {
+    try
+     {
+      [[maybe_unused]] const RecurrenceRule rule = RecurrenceRule(Frequency::Yearly).withByDay(Weekdays::Monday, 54);
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"ordinal is < -53 or > 53"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(RecurrenceRuleTest, withByDay3)
+   {
+    RecurrenceRule rule {Frequency::Yearly};
+    for (long ordinal = 1; ordinal <= RecurrenceRule::maxOrdinals; ++ordinal)
+     {
+      rule = rule.withByDay(Weekdays::Monday, ordinal);
+     }
+    try
+     {
+      rule = rule.withByDay(Weekdays::Monday, 17);
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"more than 16 ordinals"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(RecurrenceRuleTest, withByMonthDay1)
+   {
+    constexpr RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withByMonthDay(1).withByMonthDay(31).withByMonthDay(-1);
+    ASSERT_EQ(rule.getMonthDays(), (1U << 1U) | (1U << 31U));
+    ASSERT_EQ(rule.getLastMonthDays(), 1U << 1U);
+   }
+
+
+  TEST(RecurrenceRuleTest, withByMonthDay2)
+   {
+    try
+     {
+      [[maybe_unused]] const RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withByMonthDay(0);
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"day is 0 or < -31 or > 31"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(RecurrenceRuleTest, withBySetPos1)
+   {
+    constexpr RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withBySetPos(-1).withBySetPos(2);
+    ASSERT_EQ(rule.getSetPositionCount(), 2);
+    ASSERT_EQ(rule.getSetPosition(0), -1);
+    ASSERT_EQ(rule.getSetPosition(1), 2);
+   }
+
+
+  TEST(RecurrenceRuleTest, withBySetPos2)
+   {
+    try
+     {
+      [[maybe_unused]] const RecurrenceRule rule = RecurrenceRule(Frequency::Monthly).withBySetPos(367);
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"position is 0 or < -366 or > 366"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(RecurrenceRuleTest, withCount1)
+   {
+    constexpr RecurrenceRule rule = RecurrenceRule(Frequency::Daily).withCount(10);
+    ASSERT_EQ(rule.getCount(), 10);
+   }
+
+
+  TEST(RecurrenceRuleTest, withCount2)
+   {
+    try
+     {
+      [[maybe_unused]] const RecurrenceRule rule = RecurrenceRule(Frequency::Daily).withCount(0);
+      FAIL() << "Expected std::out_of_range";
+     }
+    catch(const std::out_of_range& e)
+     {
+      ASSERT_EQ(std::string{"count is 0"}.compare(e.what()), 0);
+     }
+   }
+
+
+  TEST(RecurrenceRuleTest, withUntil1)
+   {
+    constexpr RecurrenceRule rule = RecurrenceRule(Frequency::Daily).withUntil(JD(2460000)).withSkip(SkipRule::Backward);
+    ASSERT_EQ(rule.getUntil(), 2460000);
+    ASSERT_EQ(rule.getSkip(), SkipRule::Backward);
+   }
+
+ }
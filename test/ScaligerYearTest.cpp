@@ -107,6 +107,29 @@ namespace
    }
 
 
+  TEST(ScaligerYearTest, tryMake1)
+   {
+    constexpr Expected<ScaligerYear> year = ScaligerYear::tryMake(4707);
+    ASSERT_TRUE(year.hasValue());
+    ASSERT_EQ(year.getValue().getYear(), 4707);
+   }
+
+
+  TEST(ScaligerYearTest, tryMake2)
+   {
+    constexpr Expected<ScaligerYear> year = ScaligerYear::tryMake(6296);
+    ASSERT_FALSE(year.hasValue());
+    ASSERT_EQ(year.getError(), ValidationError::YearOutOfRange);
+   }
+
+
+  TEST(ScaligerYearTest, uncheckedConstructor1)
+   {
+    constexpr ScaligerYear year {unchecked, 6295};
+    ASSERT_EQ(year.getYear(), 6295);
+   }
+
+
   TEST(ScaligerYearTest, copyConstructor)
    {
     constexpr ScaligerYear year1 {4707};
@@ -124,6 +147,24 @@ namespace
    }
 
 
+  TEST(ScaligerYearTest, copyAssignment)
+   {
+    const ScaligerYear year1 {4707};
+    ScaligerYear year2 {4708};
+    year2 = year1;
+    ASSERT_EQ(year2.getYear(), 4707);
+   }
+
+
+  TEST(ScaligerYearTest, moveAssignment)
+   {
+    ScaligerYear year1 {4707};
+    ScaligerYear year2 {4708};
+    year2 = std::move(year1);
+    ASSERT_EQ(year2.getYear(), 4707);
+   }
+
+
   TEST(ScaligerYearTest, getJD1)
    {
     constexpr ScaligerYear year {4721};
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2024 Dipl.-Inform. Kai Hofmann. All rights reserved!
+ */
+
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+#include "ValidationError.h"
+
+using namespace de::powerstat::datelib;
+
+
+namespace
+ {
+  TEST(ValidationErrorTest, enum1)
+   {
+    ASSERT_EQ(static_cast<unsigned short>(ValidationError::None), 0);
+    ASSERT_EQ(static_cast<unsigned short>(ValidationError::YearOutOfRange), 1);
+    ASSERT_EQ(static_cast<unsigned short>(ValidationError::MonthOutOfRange), 2);
+    ASSERT_EQ(static_cast<unsigned short>(ValidationError::DayOutOfRange), 3);
+    ASSERT_EQ(static_cast<unsigned short>(ValidationError::WeekOutOfRange), 4);
+    ASSERT_EQ(static_cast<unsigned short>(ValidationError::JDOutOfRange), 5);
+   }
+
+
+  TEST(ValidationErrorTest, coutValidationError1)
+   {
+    constexpr ValidationError error {ValidationError::DayOutOfRange};
+    testing::internal::CaptureStdout();
+    std::cout << error;
+    const std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output, "ValidationError(DayOutOfRange)");
+   }
+
+ }
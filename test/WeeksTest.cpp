@@ -48,6 +48,24 @@ namespace
    }
 
 
+  TEST(WeeksTest, copyAssignment)
+   {
+    const Weeks weeks1 {12};
+    Weeks weeks2 {1};
+    weeks2 = weeks1;
+    ASSERT_EQ(weeks2.getWeeks(), 12);
+   }
+
+
+  TEST(WeeksTest, moveAssignment)
+   {
+    Weeks weeks1 {12};
+    Weeks weeks2 {1};
+    weeks2 = std::move(weeks1);
+    ASSERT_EQ(weeks2.getWeeks(), 12);
+   }
+
+
   TEST(WeeksTest, equalOperator1)
    {
     constexpr Weeks weeks1 {12};
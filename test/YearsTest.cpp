@@ -48,6 +48,24 @@ namespace
    }
 
 
+  TEST(YearsTest, copyAssignment)
+   {
+    const Years years1 {12};
+    Years years2 {1};
+    years2 = years1;
+    ASSERT_EQ(years2.getYears(), 12);
+   }
+
+
+  TEST(YearsTest, moveAssignment)
+   {
+    Years years1 {12};
+    Years years2 {1};
+    years2 = std::move(years1);
+    ASSERT_EQ(years2.getYears(), 12);
+   }
+
+
   TEST(YearsTest, equalOperator1)
    {
     constexpr Years years1 {12};